@@ -2,6 +2,8 @@
 #define CF_MODULE_CONFIG
 //#define CF_MODULE_PERMISSIONS
 
+//#define CF_PROFILER
+
 #define CF_GHOSTICONS_V2
 
 #ifdef CF_MODULE_LAYOUT_BINDING
@@ -0,0 +1,71 @@
+/**
+ * @brief Interns identifiers (tag, attribute, config member and RPC names) so
+ * each distinct string is stored once and can be compared as a small integer.
+ *
+ * Ids are stable for the lifetime of the game and are never reused. The
+ * pool is not emptied by CommunityFramework::_Cleanup, ids live on in XML
+ * documents, config entries and RPC registrations that outlive a cleanup.
+ *
+ * @code
+ * int id = CF.StringPool.Intern( "nominal" );
+ * string name = CF.StringPool.Get( id );
+ * @endcode
+ */
+class CF_StringPool
+{
+	static const int INVALID = -1;
+
+	protected static ref map< string, int > s_Ids = new map< string, int >();
+	protected static ref array< string > s_Strings = new array< string >();
+
+	//!Single static instance. Do not create with new or spawn - use CF.StringPool for access instead.
+	protected void CF_StringPool();
+	protected void ~CF_StringPool();
+
+	/**
+	 * @brief Returns the id of the string, adding it to the pool if it isn't there yet
+	 */
+	static int Intern( string value )
+	{
+		int id;
+		if ( s_Ids.Find( value, id ) )
+			return id;
+
+		id = s_Strings.Insert( value );
+		s_Ids.Insert( value, id );
+		return id;
+	}
+
+	/**
+	 * @brief Returns the id of an already interned string without adding it.
+	 *
+	 * Use this for lookups and for anything received over the network so
+	 * untrusted input can't grow the pool.
+	 *
+	 * @return int		the id, CF_StringPool.INVALID if the string was never interned
+	 */
+	static int Find( string value )
+	{
+		int id;
+		if ( s_Ids.Find( value, id ) )
+			return id;
+
+		return INVALID;
+	}
+
+	/**
+	 * @brief Returns the string for the id, empty if the id is invalid
+	 */
+	static string Get( int id )
+	{
+		if ( id < 0 || id >= s_Strings.Count() )
+			return "";
+
+		return s_Strings[id];
+	}
+
+	static int Count()
+	{
+		return s_Strings.Count();
+	}
+};
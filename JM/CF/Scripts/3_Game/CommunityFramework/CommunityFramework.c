@@ -18,6 +18,15 @@ class CommunityFramework
 {
     static CF_ObjectManager ObjectManager;
 	static CF_XML XML;
+	static CF_JSON JSON;
+	static CF_StringPool StringPool;
+	static CF_ConfigWatcher ConfigWatcher;
+	static CF_Clock Clock;
+	static CF_PlayerData PlayerData;
+
+	#ifdef CF_PROFILER
+	static CF_Profiler Profiler;
+	#endif
 
 	#ifdef CF_MODULE_PERMISSIONS
 	static ref CF_Permission_ManagerBase Permission;
@@ -53,6 +62,11 @@ class CommunityFramework
     {
         ObjectManager._Cleanup();
 		XML._Cleanup();
+		JSON._Cleanup();
+		ConfigWatcher._Cleanup();
+		PlayerData._Cleanup();
+		CF_TypeInfo._Cleanup();
+		CF_BinarySerializer._Cleanup();
 
 		#ifdef CF_MODULE_PERMISSIONS
 		Permission._Cleanup();
@@ -282,7 +296,7 @@ static void CF_DumpWidgets( Widget root, int tabs = 0 )
 static void Assert_Log( string str )
 {
 	Print( "==============================================WARNING=======================================================" );
-	string time = JMDate.Now( false ).ToString( "YYYY-MM-DD hh:mm:ss" );
+	string time = CF_Clock.Format( "YYYY-MM-DD hh:mm:ss" );
 	Print( "[WARNING " + time + "] " + str );
 	Print( "Do you see this message? Unless the time is within a second of the crash than this was not the cause." );
 
@@ -0,0 +1,257 @@
+/**
+ * @brief Copies a ConfigClass onto the member variables of a script object
+ * with the same names, case insensitive. Nested classes become nested
+ * objects and config arrays fill array members.
+ *
+ * Walks the config once, field lookups use the cached CF_TypeInfo of the
+ * target type and the interned lowercase entry names.
+ */
+class ConfigBinder
+{
+	private void ConfigBinder()
+	{
+	}
+
+	static void Bind( ConfigClass config, Class target )
+	{
+		if ( !config || !target )
+			return;
+
+		//! Entries of the base class first so the derived class overrides them
+		if ( config.GetBase() )
+			Bind( config.GetBase(), target );
+
+		CF_TypeInfo info = CF_TypeInfo.Get( target.Type() );
+
+		for ( int i = 0; i < config.Count(); i++ )
+		{
+			ConfigEntry entry = config.Get( i );
+
+			CF_FieldInfo field = info.FindField( entry.GetLowerNameId() );
+			if ( !field )
+				continue;
+
+			BindField( entry, target, field );
+		}
+	}
+
+	protected static void BindField( ConfigEntry entry, Class target, CF_FieldInfo field )
+	{
+		switch ( field.Kind )
+		{
+		case CF_FieldKind.BOOL:
+			EnScript.SetClassVar( target, field.Name, 0, GetBool( entry ) );
+			return;
+		case CF_FieldKind.INT:
+			EnScript.SetClassVar( target, field.Name, 0, GetInt( entry ) );
+			return;
+		case CF_FieldKind.FLOAT:
+			EnScript.SetClassVar( target, field.Name, 0, GetFloat( entry ) );
+			return;
+		case CF_FieldKind.STRING:
+			EnScript.SetClassVar( target, field.Name, 0, GetString( entry ) );
+			return;
+		case CF_FieldKind.VECTOR:
+			EnScript.SetClassVar( target, field.Name, 0, GetVector( entry ) );
+			return;
+		case CF_FieldKind.CLASS:
+			if ( !entry.IsInherited( ConfigClass ) || entry.IsInherited( ConfigClassDeclaration ) )
+				return;
+
+			Class child;
+			EnScript.GetClassVar( target, field.Name, 0, child );
+			if ( !child )
+			{
+				child = field.Type.Spawn();
+				if ( !child )
+					return;
+
+				EnScript.SetClassVar( target, field.Name, 0, child );
+			}
+
+			Bind( entry.GetClass(), child );
+			return;
+		case CF_FieldKind.ARRAY:
+			if ( entry.IsArray() )
+			{
+				BindArray( entry.GetArray(), target, field );
+			} else if ( field.ElementKind == CF_FieldKind.CLASS && entry.IsInherited( ConfigClass ) )
+			{
+				BindClassArray( entry.GetClass(), target, field );
+			}
+			return;
+		}
+	}
+
+	protected static Class GetOrCreateArray( Class target, CF_FieldInfo field )
+	{
+		Class arr;
+		EnScript.GetClassVar( target, field.Name, 0, arr );
+		if ( !arr )
+		{
+			arr = field.Type.Spawn();
+			if ( arr )
+				EnScript.SetClassVar( target, field.Name, 0, arr );
+		}
+
+		return arr;
+	}
+
+	/**
+	 * @brief Config arrays can't hold classes, an array of objects is written
+	 * as a class whose child classes are the elements
+	 *
+	 * @code
+	 * class Spawns
+	 * {
+	 * 	class Spawn1 { position[] = { 100, 0, 200 }; };
+	 * 	class Spawn2 { position[] = { 300, 0, 400 }; };
+	 * };
+	 * @endcode
+	 */
+	protected static void BindClassArray( ConfigClass config, Class target, CF_FieldInfo field )
+	{
+		Class arr = GetOrCreateArray( target, field );
+		if ( !arr )
+			return;
+
+		g_Script.CallFunctionParams( arr, "Clear", NULL, NULL );
+
+		for ( int i = 0; i < config.Count(); i++ )
+		{
+			ConfigEntry entry = config.Get( i );
+			if ( !entry.IsInherited( ConfigClass ) || entry.IsInherited( ConfigClassDeclaration ) )
+				continue;
+
+			Class element = field.ElementType.Spawn();
+			if ( !element )
+				continue;
+
+			Bind( entry.GetClass(), element );
+
+			g_Script.CallFunction( arr, "Insert", NULL, element );
+		}
+	}
+
+	protected static void BindArray( ConfigArray config, Class target, CF_FieldInfo field )
+	{
+		Class arr = GetOrCreateArray( target, field );
+		if ( !arr )
+			return;
+
+		int i;
+		int count = config.Count();
+
+		switch ( field.ElementKind )
+		{
+		case CF_FieldKind.BOOL:
+			array< bool > bools = array< bool >.Cast( arr );
+			bools.Clear();
+			for ( i = 0; i < count; i++ )
+				bools.Insert( GetBool( config.Get( i ) ) );
+			return;
+		case CF_FieldKind.INT:
+			array< int > ints = array< int >.Cast( arr );
+			ints.Clear();
+			for ( i = 0; i < count; i++ )
+				ints.Insert( GetInt( config.Get( i ) ) );
+			return;
+		case CF_FieldKind.FLOAT:
+			array< float > floats = array< float >.Cast( arr );
+			floats.Clear();
+			for ( i = 0; i < count; i++ )
+				floats.Insert( GetFloat( config.Get( i ) ) );
+			return;
+		case CF_FieldKind.STRING:
+			array< string > strings = array< string >.Cast( arr );
+			strings.Clear();
+			for ( i = 0; i < count; i++ )
+				strings.Insert( GetString( config.Get( i ) ) );
+			return;
+		case CF_FieldKind.VECTOR:
+			array< vector > vectors = array< vector >.Cast( arr );
+			vectors.Clear();
+			for ( i = 0; i < count; i++ )
+				vectors.Insert( GetVector( config.Get( i ) ) );
+			return;
+		}
+
+		Error( "ConfigBinder: array member " + field.Name + " of type " + field.Type.ToString() + " is not supported" );
+	}
+
+	static bool GetBool( ConfigEntry entry )
+	{
+		if ( entry.IsText() )
+		{
+			string text = entry.GetText();
+			text.ToLower();
+			return text == "true" || text == "1";
+		}
+
+		return GetInt( entry ) != 0;
+	}
+
+	static int GetInt( ConfigEntry entry )
+	{
+		if ( entry.IsInt() )
+			return entry.GetInt();
+		if ( entry.IsFloat() )
+			return entry.GetFloat();
+		if ( entry.IsLong() )
+			return entry.GetLong();
+		if ( entry.IsText() )
+			return entry.GetText().ToInt();
+
+		return 0;
+	}
+
+	static float GetFloat( ConfigEntry entry )
+	{
+		if ( entry.IsFloat() )
+			return entry.GetFloat();
+		if ( entry.IsInt() )
+			return entry.GetInt();
+		if ( entry.IsLong() )
+			return entry.GetLong();
+		if ( entry.IsText() )
+			return entry.GetText().ToFloat();
+
+		return 0;
+	}
+
+	static string GetString( ConfigEntry entry )
+	{
+		if ( entry.IsText() )
+			return entry.GetText();
+		if ( entry.IsFloat() )
+			return entry.GetFloat().ToString();
+		if ( entry.IsInt() )
+			return entry.GetInt().ToString();
+		if ( entry.IsLong() )
+			return entry.GetLong().ToString();
+
+		return "";
+	}
+
+	/**
+	 * @brief Accepts both "x y z" text and a { x, y, z } array
+	 */
+	static vector GetVector( ConfigEntry entry )
+	{
+		if ( entry.IsArray() )
+		{
+			ConfigArray arr = entry.GetArray();
+
+			vector value;
+			for ( int i = 0; i < 3 && i < arr.Count(); i++ )
+				value[i] = GetFloat( arr.Get( i ) );
+
+			return value;
+		}
+
+		if ( entry.IsText() )
+			return entry.GetText().ToVector();
+
+		return vector.Zero;
+	}
+};
@@ -41,7 +41,7 @@ class ConfigClass : ConfigEntry
 	private ref ConfigClass SetBase( string name )
 	{
 		int baseIndex = _parent.FindIndex( name );
-		int thisIndex = _parent.FindIndex( _name );
+		int thisIndex = _parent.FindIndex( _nameId );
 		if ( baseIndex >= 0 && ( baseIndex < thisIndex || thisIndex < 0 ) )
 		{
 			return _parent._entries[ baseIndex ].GetClass();
@@ -135,7 +135,7 @@ class ConfigClass : ConfigEntry
 				if ( c == ";" )
 				{
 					entry = new ConfigDelete();
-					entry._name = name;
+					entry.SetName( name );
 					entry._parent = this;
 				} else
 				{
@@ -151,12 +151,12 @@ class ConfigClass : ConfigEntry
 				if ( c == ";" )
 				{
 					entry = new ConfigClassDeclaration();
-					entry._name = name;
+					entry.SetName( name );
 					entry._parent = this;
 				} else
 				{
 					entry = new ConfigClass();
-					entry._name = name;
+					entry.SetName( name );
 					entry._parent = this;
 
 					if ( c == ":" )
@@ -221,7 +221,7 @@ class ConfigClass : ConfigEntry
 					}
 
 					entry = new ConfigArray();
-					entry._name = name;
+					entry.SetName( name );
 					entry._parent = this;
 					if ( !entry.Parse( reader, file ) )
 						return false;
@@ -276,7 +276,7 @@ class ConfigClass : ConfigEntry
 					if ( quoted )
 					{
 						entry = new ConfigValueText();
-						entry._name = name;
+						entry.SetName( name );
 						entry.SetText( value );
 						entry._parent = this;
 					} else
@@ -284,13 +284,13 @@ class ConfigClass : ConfigEntry
 						if ( value.Contains( "." ) )
 						{
 							entry = new ConfigValueFloat();
-							entry._name = name;
+							entry.SetName( name );
 							entry.SetFloat( value.ToFloat() );
 							entry._parent = this;
 						} else
 						{
 							entry = new ConfigValueInt();
-							entry._name = name;
+							entry.SetName( name );
 							entry.SetInt( value.ToInt() );
 							entry._parent = this;
 						}
@@ -300,13 +300,13 @@ class ConfigClass : ConfigEntry
 
 			if ( entry != NULL )
 			{
-				int idx = FindIndex( entry._name );
+				int idx = FindIndex( entry.GetNameId() );
 				if ( idx < 0)
 				{
 					_entries.Insert( entry );
 				} else
 				{
-					reader.Error( "'" + entry._name + "' already defined" );
+					reader.Error( "'" + entry.GetName() + "' already defined" );
 				}
 			}
 		}
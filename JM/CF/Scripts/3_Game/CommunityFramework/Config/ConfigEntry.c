@@ -4,7 +4,9 @@ class ConfigEntry : Managed
 
 	protected ref ConfigEntry _parent;
 
-	protected string _name;
+	//! Interned through CF_StringPool, the lowercase id is used for case insensitive lookups
+	protected int _nameId;
+	protected int _lowerNameId;
 
 	void ConfigEntry()
 	{
@@ -12,7 +14,7 @@ class ConfigEntry : Managed
 
 		_parent = NULL;
 
-		_name = "";
+		SetName( "" );
 	}
 
 	string GetType()
@@ -22,7 +24,25 @@ class ConfigEntry : Managed
 
 	string GetName()
 	{
-		return _name;
+		return CF_StringPool.Get( _nameId );
+	}
+
+	int GetNameId()
+	{
+		return _nameId;
+	}
+
+	int GetLowerNameId()
+	{
+		return _lowerNameId;
+	}
+
+	void SetName( string name )
+	{
+		_nameId = CF_StringPool.Intern( name );
+
+		name.ToLower();
+		_lowerNameId = CF_StringPool.Intern( name );
 	}
 
 	ConfigEntry GetParent()
@@ -138,12 +158,20 @@ class ConfigEntry : Managed
 
 	int FindIndex( string name, bool isClass = false )
 	{
+		return FindIndex( CF_StringPool.Find( name ), isClass );
+	}
+
+	int FindIndex( int nameId, bool isClass = false )
+	{
+		if ( nameId == CF_StringPool.INVALID )
+			return -1;
+
 		for ( int i = 0; i < _entries.Count(); i++ )
 		{
 			if ( isClass && !_entries[i].IsClass() )
 				continue;
 
-			if ( _entries[i]._name == name )
+			if ( _entries[i]._nameId == nameId )
 				return i;
 		}
 
@@ -165,27 +193,45 @@ class ConfigEntry : Managed
 
 	ref ConfigEntry Get( TStringArray tokens, int index = 0 )
 	{
-		string lowerToken = "" + tokens[ index ];
-		lowerToken.ToLower();
-		for ( int k = 0; k < _entries.Count(); ++k )
+		array< int > lowerIds = new array< int >();
+		for ( int i = 0; i < tokens.Count(); ++i )
 		{
-			string nameLower = "" + _entries[k]._name;
-			nameLower.ToLower();
+			string lowerToken = "" + tokens[ i ];
+			lowerToken.ToLower();
+
+			//! A name that was never interned can't match any entry
+			int lowerId = CF_StringPool.Find( lowerToken );
+			if ( lowerId == CF_StringPool.INVALID )
+				return NULL;
+
+			lowerIds.Insert( lowerId );
+		}
 
-			if ( lowerToken == nameLower )
+		return Get( lowerIds, index );
+	}
+
+	/**
+	 * @brief Path lookup by lowercase interned names, see GetLowerNameId
+	 */
+	ref ConfigEntry Get( array< int > lowerIds, int index = 0 )
+	{
+		int lowerId = lowerIds[ index ];
+		for ( int k = 0; k < _entries.Count(); ++k )
+		{
+			if ( lowerId == _entries[k]._lowerNameId )
 			{
-				if ( index + 1 >= tokens.Count() )
+				if ( index + 1 >= lowerIds.Count() )
 				{
 					return _entries[k];
 				}
 
-				return _entries[k].Get( tokens, index + 1 );
+				return _entries[k].Get( lowerIds, index + 1 );
 			}
 		}
 
 		if ( IsClass() && GetClass().GetBase() != NULL )
 		{
-			return GetClass().GetBase().Get( tokens, index );
+			return GetClass().GetBase().Get( lowerIds, index );
 		}
 
 		return NULL;
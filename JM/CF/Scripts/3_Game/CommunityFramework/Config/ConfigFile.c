@@ -13,10 +13,33 @@ class ConfigFile : ConfigClass
 
 	static ref ConfigFile Parse( string fileName )
 	{
-		ref ConfigFile file = new ConfigFile();
+		ref ConfigFile file;
+		ParseFile( fileName, file );
+		return file;
+	}
 
-		file.Parse( ConfigReader.Open( fileName ), file );
+	/**
+	 * @brief Parses the file, the returned ConfigFile holds whatever could be read before an error
+	 *
+	 * @return bool		false if the file doesn't exist or has a syntax error
+	 */
+	static bool ParseFile( string fileName, out ConfigFile file )
+	{
+		file = new ConfigFile();
 
-		return file;
+		if ( !FileExist( fileName ) )
+			return false;
+
+		#ifdef CF_PROFILER
+		CF_Profiler.Begin( "ConfigFile::Parse" );
+		#endif
+
+		bool success = file.Parse( ConfigReader.Open( fileName ), file );
+
+		#ifdef CF_PROFILER
+		CF_Profiler.End();
+		#endif
+
+		return success;
 	}
 };
\ No newline at end of file
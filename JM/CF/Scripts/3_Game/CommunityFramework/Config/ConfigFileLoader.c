@@ -0,0 +1,51 @@
+/**
+ * @brief JsonFileLoader for config.cpp style files
+ *
+ * @code
+ * class MySettings
+ * {
+ * 	int MaxPlayers;
+ * 	ref array< string > Admins;
+ * };
+ *
+ * MySettings settings;
+ * ConfigFileLoader< MySettings >.LoadFile( "$profile:MyMod/settings.cpp", settings );
+ * @endcode
+ */
+class ConfigFileLoader< Class T >
+{
+	/**
+	 * @brief Parses the file and binds it onto data, creating data if it is NULL
+	 *
+	 * @param className		bind this top level class instead of the whole file
+	 * @return bool			false if the file couldn't be parsed or the class wasn't found
+	 */
+	static bool LoadFile( string path, out T data, string className = "" )
+	{
+		ConfigFile file;
+		if ( !ConfigFile.ParseFile( path, file ) )
+		{
+			Error( "ConfigFileLoader: failed to parse " + path );
+			return false;
+		}
+
+		ConfigClass config = file;
+		if ( className != "" )
+		{
+			ConfigEntry entry = file.Get( className );
+			if ( !entry || !entry.IsInherited( ConfigClass ) )
+			{
+				Error( "ConfigFileLoader: class " + className + " not found in " + path );
+				return false;
+			}
+
+			config = entry.GetClass();
+		}
+
+		if ( !data )
+			data = new T();
+
+		ConfigBinder.Bind( config, data );
+		return true;
+	}
+};
@@ -0,0 +1,433 @@
+/**
+ * @brief Paths use the same space separated form as ConfigEntry::Get
+ */
+class CF_ConfigDiff : Managed
+{
+	ref array< string > Added = new array< string >();
+	ref array< string > Removed = new array< string >();
+	ref array< string > Changed = new array< string >();
+
+	bool IsEmpty()
+	{
+		return Added.Count() == 0 && Removed.Count() == 0 && Changed.Count() == 0;
+	}
+
+	/**
+	 * @brief Compares two snapshots made with CF_ConfigDiff.Snapshot
+	 */
+	static ref CF_ConfigDiff Compare( map< string, string > previous, map< string, string > current )
+	{
+		CF_ConfigDiff diff = new CF_ConfigDiff();
+
+		int i;
+		string path;
+		string value;
+
+		for ( i = 0; i < current.Count(); i++ )
+		{
+			path = current.GetKey( i );
+
+			if ( !previous.Find( path, value ) )
+			{
+				diff.Added.Insert( path );
+			} else if ( value != current.GetElement( i ) )
+			{
+				diff.Changed.Insert( path );
+			}
+		}
+
+		for ( i = 0; i < previous.Count(); i++ )
+		{
+			path = previous.GetKey( i );
+
+			if ( !current.Contains( path ) )
+				diff.Removed.Insert( path );
+		}
+
+		return diff;
+	}
+
+	/**
+	 * @brief Flattens the tree into path -> value, classes map to their base
+	 */
+	static ref map< string, string > Snapshot( ConfigEntry root )
+	{
+		map< string, string > snapshot = new map< string, string >();
+		Snapshot( root, "", snapshot );
+		return snapshot;
+	}
+
+	protected static void Snapshot( ConfigEntry entry, string prefix, map< string, string > snapshot )
+	{
+		for ( int i = 0; i < entry.Count(); i++ )
+		{
+			ConfigEntry child = entry.Get( i );
+			string path = prefix + child.GetName();
+
+			if ( child.IsInherited( ConfigDelete ) )
+			{
+				snapshot.Set( path, "delete" );
+			} else if ( child.IsInherited( ConfigClassDeclaration ) )
+			{
+				snapshot.Set( path, "class;" );
+			} else if ( child.IsInherited( ConfigClass ) )
+			{
+				string base = "";
+				if ( child.GetClass().GetBase() )
+					base = child.GetClass().GetBase().GetName();
+
+				snapshot.Set( path, "class:" + base );
+				Snapshot( child, path + " ", snapshot );
+			} else
+			{
+				snapshot.Set( path, ValueToString( child ) );
+			}
+		}
+	}
+
+	protected static string ValueToString( ConfigEntry entry )
+	{
+		if ( entry.IsArray() )
+		{
+			ConfigArray arr = entry.GetArray();
+
+			string str = "{";
+			for ( int i = 0; i < arr.Count(); i++ )
+			{
+				if ( i > 0 )
+					str += ",";
+
+				str += ValueToString( arr.Get( i ) );
+			}
+
+			return str + "}";
+		}
+
+		if ( entry.IsText() )
+			return "\"" + entry.GetText() + "\"";
+
+		if ( entry.IsFloat() )
+			return entry.GetFloat().ToString();
+
+		if ( entry.IsInt() )
+			return entry.GetInt().ToString();
+
+		if ( entry.IsLong() )
+			return entry.GetLong().ToString();
+
+		return entry.GetType();
+	}
+};
+
+class CF_ConfigWatcherCallback : Managed
+{
+	/**
+	 * @brief The config file changed and parsed without errors
+	 */
+	void OnConfigChanged( string path, ConfigFile file, CF_ConfigDiff diff );
+
+	/**
+	 * @brief The XML file changed and parsed without errors
+	 */
+	void OnXMLChanged( string path, CF_XML_Document document );
+};
+
+class CF_ConfigWatch : Managed
+{
+	string Path;
+	bool IsXML;
+
+	int Length;
+	int Hash;
+
+	ref map< string, string > Snapshot;
+
+	//! Weak, subscribers that are deleted are dropped
+	ref array< CF_ConfigWatcherCallback > Callbacks = new array< CF_ConfigWatcherCallback >();
+
+	void CF_ConfigWatch( string path, bool isXML )
+	{
+		Path = path;
+		IsXML = isXML;
+	}
+
+	/**
+	 * @brief There is no API for the size or modification time of a file so
+	 * the content length and a hash of the lines are used instead
+	 *
+	 * @return bool		true if the file differs from the last fingerprint
+	 */
+	bool UpdateFingerprint()
+	{
+		int length = 0;
+		int hash = 0;
+
+		FileHandle handle = OpenFile( Path, FileMode.READ );
+		if ( handle != 0 )
+		{
+			string line;
+			while ( FGets( handle, line ) >= 0 )
+			{
+				length += line.Length() + 1;
+				hash = hash * 31 + line.Hash();
+			}
+
+			CloseFile( handle );
+		}
+
+		if ( length == Length && hash == Hash )
+			return false;
+
+		Length = length;
+		Hash = hash;
+		return true;
+	}
+
+	void Notify( ConfigFile file, CF_ConfigDiff diff, CF_XML_Document document )
+	{
+		for ( int i = Callbacks.Count() - 1; i >= 0; i-- )
+		{
+			if ( !Callbacks[i] )
+				Callbacks.Remove( i );
+		}
+
+		//! Copy so a subscriber may unwatch from inside the callback
+		array< CF_ConfigWatcherCallback > callbacks = new array< CF_ConfigWatcherCallback >();
+		callbacks.Copy( Callbacks );
+
+		for ( int j = 0; j < callbacks.Count(); j++ )
+		{
+			if ( !callbacks[j] )
+				continue;
+
+			if ( IsXML )
+			{
+				callbacks[j].OnXMLChanged( Path, document );
+			} else
+			{
+				callbacks[j].OnConfigChanged( Path, file, diff );
+			}
+		}
+	}
+};
+
+/**
+ * @brief Polls watched config and XML files on a timer, one file per tick,
+ * and re-parses only the files whose content changed.
+ *
+ * @code
+ * CF.ConfigWatcher.WatchConfig( "$profile:MyMod/settings.cpp", m_SettingsCallback, m_Settings );
+ * @endcode
+ */
+class CF_ConfigWatcher
+{
+	protected static ref array< ref CF_ConfigWatch > s_Watches = new array< ref CF_ConfigWatch >();
+	protected static int s_Index;
+
+	protected static int s_Interval = 1000;
+	protected static bool s_Running;
+
+	//!Single static instance. Do not create with new or spawn - use CF.ConfigWatcher for access instead.
+	protected void CF_ConfigWatcher();
+	protected void ~CF_ConfigWatcher();
+
+	/**
+	 * @brief [Internal] CommunityFramework cleanup
+	 */
+	static void _Cleanup()
+	{
+		Stop();
+
+		s_Watches.Clear();
+		s_Index = 0;
+	}
+
+	/**
+	 * @brief Watches a config.cpp style file
+	 *
+	 * @param current	the already parsed file, used as the base for the first diff.
+	 *					If NULL the file is parsed once now.
+	 */
+	static void WatchConfig( string path, notnull CF_ConfigWatcherCallback callback, ConfigFile current = NULL )
+	{
+		CF_ConfigWatch watch = Add( path, false, callback );
+		if ( watch.Snapshot )
+			return;
+
+		if ( !current )
+			ConfigFile.ParseFile( path, current );
+
+		watch.Snapshot = CF_ConfigDiff.Snapshot( current );
+	}
+
+	static void WatchXML( string path, notnull CF_ConfigWatcherCallback callback )
+	{
+		Add( path, true, callback );
+	}
+
+	/**
+	 * @brief Removes the callback from the config watch of the file, or every callback if NULL
+	 */
+	static void UnwatchConfig( string path, CF_ConfigWatcherCallback callback = NULL )
+	{
+		Remove( path, false, callback );
+	}
+
+	/**
+	 * @brief Removes the callback from the XML watch of the file, or every callback if NULL
+	 */
+	static void UnwatchXML( string path, CF_ConfigWatcherCallback callback = NULL )
+	{
+		Remove( path, true, callback );
+	}
+
+	/**
+	 * @brief Time between two checks, each check looks at a single file
+	 */
+	static void SetInterval( int milliseconds )
+	{
+		s_Interval = Math.Max( milliseconds, 1 );
+
+		if ( s_Running )
+		{
+			Stop();
+			Start();
+		}
+	}
+
+	static int GetInterval()
+	{
+		return s_Interval;
+	}
+
+	/**
+	 * @brief Checks every watched file immediately
+	 */
+	static void CheckAll()
+	{
+		for ( int i = 0; i < s_Watches.Count(); i++ )
+			Check( s_Watches[i] );
+	}
+
+	protected static CF_ConfigWatch Add( string path, bool isXML, CF_ConfigWatcherCallback callback )
+	{
+		CF_ConfigWatch watch;
+		for ( int i = 0; i < s_Watches.Count(); i++ )
+		{
+			if ( s_Watches[i].Path == path && s_Watches[i].IsXML == isXML )
+			{
+				watch = s_Watches[i];
+				break;
+			}
+		}
+
+		if ( !watch )
+		{
+			watch = new CF_ConfigWatch( path, isXML );
+			watch.UpdateFingerprint();
+			s_Watches.Insert( watch );
+		}
+
+		if ( watch.Callbacks.Find( callback ) == -1 )
+			watch.Callbacks.Insert( callback );
+
+		Start();
+
+		return watch;
+	}
+
+	protected static void Remove( string path, bool isXML, CF_ConfigWatcherCallback callback )
+	{
+		for ( int i = 0; i < s_Watches.Count(); i++ )
+		{
+			CF_ConfigWatch watch = s_Watches[i];
+			if ( watch.Path != path || watch.IsXML != isXML )
+				continue;
+
+			if ( callback )
+			{
+				int index = watch.Callbacks.Find( callback );
+				if ( index != -1 )
+					watch.Callbacks.Remove( index );
+
+				if ( watch.Callbacks.Count() > 0 )
+					return;
+			}
+
+			s_Watches.RemoveOrdered( i );
+
+			if ( s_Watches.Count() == 0 )
+				Stop();
+
+			return;
+		}
+	}
+
+	protected static void Start()
+	{
+		if ( s_Running || !GetGame() )
+			return;
+
+		s_Running = true;
+		GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).CallLater( OnTick, s_Interval, true );
+	}
+
+	protected static void Stop()
+	{
+		if ( !s_Running )
+			return;
+
+		s_Running = false;
+
+		if ( GetGame() )
+			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).Remove( OnTick );
+	}
+
+	protected static void OnTick()
+	{
+		if ( s_Watches.Count() == 0 )
+			return;
+
+		if ( s_Index >= s_Watches.Count() )
+			s_Index = 0;
+
+		Check( s_Watches[s_Index] );
+
+		s_Index++;
+	}
+
+	protected static void Check( CF_ConfigWatch watch )
+	{
+		if ( !watch.UpdateFingerprint() )
+			return;
+
+		if ( watch.IsXML )
+		{
+			CF_XML_Document document;
+			if ( !CF_XML.ReadDocument( watch.Path, document ) )
+			{
+				Error( "CF_ConfigWatcher: failed to parse " + watch.Path + ", keeping the previous version" );
+				return;
+			}
+
+			watch.Notify( NULL, NULL, document );
+			return;
+		}
+
+		ConfigFile file;
+		if ( !ConfigFile.ParseFile( watch.Path, file ) )
+		{
+			Error( "CF_ConfigWatcher: failed to parse " + watch.Path + ", keeping the previous version" );
+			return;
+		}
+
+		map< string, string > snapshot = CF_ConfigDiff.Snapshot( file );
+		CF_ConfigDiff diff = CF_ConfigDiff.Compare( watch.Snapshot, snapshot );
+		watch.Snapshot = snapshot;
+
+		if ( diff.IsEmpty() )
+			return;
+
+		watch.Notify( file, diff, NULL );
+	}
+};
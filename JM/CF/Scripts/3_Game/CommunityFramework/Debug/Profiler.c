@@ -0,0 +1,246 @@
+class CF_ProfilerZone : Managed
+{
+	string Name;
+
+	int Calls;
+	int Ticks;
+
+	CF_ProfilerZone Parent;
+	ref array< ref CF_ProfilerZone > Children;
+
+	int _Start;
+
+	void CF_ProfilerZone( string name, CF_ProfilerZone parent = NULL )
+	{
+		Name = name;
+		Parent = parent;
+		Children = new array< ref CF_ProfilerZone >();
+	}
+
+	/**
+	 * @brief Zones are few per parent so a linear search beats hashing the name
+	 */
+	CF_ProfilerZone GetChild( string name )
+	{
+		for ( int i = 0; i < Children.Count(); i++ )
+		{
+			if ( Children[i].Name == name )
+				return Children[i];
+		}
+
+		CF_ProfilerZone child = new CF_ProfilerZone( name, this );
+		Children.Insert( child );
+		return child;
+	}
+
+	int GetSelfTicks()
+	{
+		int ticks = Ticks;
+		for ( int i = 0; i < Children.Count(); i++ )
+			ticks -= Children[i].Ticks;
+
+		if ( ticks < 0 )
+			return 0;
+
+		return ticks;
+	}
+
+	void Merge( CF_ProfilerZone other )
+	{
+		Calls += other.Calls;
+		Ticks += other.Ticks;
+
+		for ( int i = 0; i < other.Children.Count(); i++ )
+		{
+			GetChild( other.Children[i].Name ).Merge( other.Children[i] );
+		}
+	}
+
+	void Debug( int level = 0 )
+	{
+		Print( CF_Indent( level ) + Name + " calls=" + Calls + " ticks=" + Ticks + " self=" + GetSelfTicks() );
+
+		for ( int i = 0; i < Children.Count(); i++ )
+			Children[i].Debug( level + 1 );
+	}
+
+	/**
+	 * @brief Writes one "parent;child;zone ticks" line per zone, the collapsed
+	 * stack format read by flamegraph.pl and compatible tools
+	 */
+	void WriteCollapsed( FileHandle handle, string prefix = "" )
+	{
+		string path = Name;
+		if ( prefix != "" )
+			path = prefix + ";" + Name;
+
+		int self = GetSelfTicks();
+		if ( self > 0 )
+			FPrintln( handle, path + " " + self );
+
+		for ( int i = 0; i < Children.Count(); i++ )
+			Children[i].WriteCollapsed( handle, path );
+	}
+};
+
+/**
+ * @brief Hierarchical CPU profiler. Zones nest and are aggregated into one
+ * tree per frame, which is then merged into a running total.
+ *
+ * Calls are only compiled in when CF_PROFILER is defined in CFDefines.c, off
+ * by default. Capturing is then off until Start is called so an idle
+ * Begin/End pair is a static call and a bool check.
+ *
+ * Zones must not stay open across a Sleep inside a script thread.
+ *
+ * @code
+ * #ifdef CF_PROFILER
+ * CF_Profiler.Begin( "MyModule::Load" );
+ * #endif
+ * ...
+ * #ifdef CF_PROFILER
+ * CF_Profiler.End();
+ * #endif
+ * @endcode
+ */
+class CF_Profiler
+{
+	static const string ROOT = "Frame";
+
+	protected static bool s_Enabled;
+	protected static bool s_Pending;
+
+	protected static int s_Frames;
+	protected static int s_FrameStart;
+
+	protected static ref CF_ProfilerZone s_Frame;
+	protected static ref CF_ProfilerZone s_LastFrame;
+	protected static ref CF_ProfilerZone s_Total;
+
+	protected static CF_ProfilerZone s_Current;
+
+	//!Single static instance. Do not create with new or spawn - use CF.Profiler for access instead.
+	protected void CF_Profiler();
+	protected void ~CF_Profiler();
+
+	/**
+	 * @brief Starts capturing from the next frame, discarding previous results
+	 */
+	static void Start()
+	{
+		s_Pending = true;
+	}
+
+	static void Stop()
+	{
+		s_Pending = false;
+		s_Enabled = false;
+	}
+
+	static bool IsEnabled()
+	{
+		return s_Enabled;
+	}
+
+	static int GetFrameCount()
+	{
+		return s_Frames;
+	}
+
+	static void Begin( string name )
+	{
+		if ( !s_Enabled )
+			return;
+
+		s_Current = s_Current.GetChild( name );
+		s_Current._Start = TickCount( 0 );
+	}
+
+	static void End()
+	{
+		if ( !s_Enabled || s_Current == s_Frame )
+			return;
+
+		s_Current.Ticks += TickCount( s_Current._Start );
+		s_Current.Calls++;
+		s_Current = s_Current.Parent;
+	}
+
+	/**
+	 * @brief [Internal] Closes the current frame tree, called once per frame from DayZGame::OnUpdate
+	 */
+	static void _OnFrame()
+	{
+		if ( s_Enabled )
+		{
+			if ( s_Current != s_Frame )
+			{
+				Error( "CF_Profiler: zone '" + s_Current.Name + "' was not ended before the end of the frame" );
+			}
+
+			s_Frame.Ticks = TickCount( s_FrameStart );
+			s_Frame.Calls = 1;
+
+			s_Total.Merge( s_Frame );
+			s_LastFrame = s_Frame;
+			s_Frames++;
+		} else if ( s_Pending )
+		{
+			s_Pending = false;
+			s_Enabled = true;
+
+			s_Total = new CF_ProfilerZone( ROOT );
+			s_LastFrame = NULL;
+			s_Frames = 0;
+		} else
+		{
+			return;
+		}
+
+		s_Frame = new CF_ProfilerZone( ROOT );
+		s_Current = s_Frame;
+		s_FrameStart = TickCount( 0 );
+	}
+
+	/**
+	 * @brief The tree of the last completed frame
+	 */
+	static CF_ProfilerZone GetLastFrame()
+	{
+		return s_LastFrame;
+	}
+
+	/**
+	 * @brief All frames captured since Start, merged into one tree
+	 */
+	static CF_ProfilerZone GetTotal()
+	{
+		return s_Total;
+	}
+
+	/**
+	 * @brief Exports the captured frames in collapsed stack format
+	 *
+	 * @param path		output file
+	 * @param lastFrame	only export the last completed frame instead of the total
+	 * @return bool		false if nothing was captured or the file couldn't be opened
+	 */
+	static bool Export( string path = "$profile:CF_Profiler.folded", bool lastFrame = false )
+	{
+		CF_ProfilerZone root = s_Total;
+		if ( lastFrame )
+			root = s_LastFrame;
+
+		if ( !root )
+			return false;
+
+		FileHandle handle = OpenFile( path, FileMode.WRITE );
+		if ( handle == 0 )
+			return false;
+
+		root.WriteCollapsed( handle );
+
+		CloseFile( handle );
+		return true;
+	}
+};
@@ -12,6 +12,19 @@ modded class DayZGame
 		//GetLogger();
 	}
 
+	override void OnUpdate( bool doSim, float timeslice )
+	{
+		CF_Clock._OnFrame();
+
+		#ifdef CF_PROFILER
+		CF_Profiler._OnFrame();
+		#endif
+
+		ViewUpdateQueue._OnFrame();
+
+		super.OnUpdate( doSim, timeslice );
+	}
+
 	override void OnRPC( PlayerIdentity sender, Object target, int rpc_type, ParamsReadContext ctx )
 	{
 		if ( rpc_type == NotificationSystemRPC.Create )
@@ -0,0 +1,203 @@
+class CF_BatchLoaderResult : Managed
+{
+	string Path;
+	bool IsXML;
+
+	bool Success;
+	string Error;
+
+	//! Set when IsXML
+	ref CF_XML_Document Document;
+
+	//! Set when not IsXML
+	ref ConfigFile Config;
+
+	void CF_BatchLoaderResult( string path, bool isXML )
+	{
+		Path = path;
+		IsXML = isXML;
+	}
+};
+
+class CF_BatchLoaderCallback : Managed
+{
+	/**
+	 * @brief Called once after every file has been loaded, check the results for per file errors
+	 */
+	void OnComplete( CF_BatchLoader loader );
+};
+
+/**
+ * @brief Loads a list of XML and config files in script threads and reports
+ * back once with every result.
+ *
+ * Up to maxConcurrent workers each take the next file in the list, parse it
+ * and yield, so the files are spread over frames instead of blocking one.
+ *
+ * @code
+ * CF_BatchLoader loader = new CF_BatchLoader();
+ * loader.AddXML( "$mission:db/types.xml" );
+ * loader.AddConfig( "$profile:MyMod/traders.cpp" );
+ * loader.Start( m_Callback );
+ * @endcode
+ */
+class CF_BatchLoader : Managed
+{
+	//! Keeps loaders alive while their threads run
+	protected static ref array< ref CF_BatchLoader > s_Running = new array< ref CF_BatchLoader >();
+
+	protected ref array< ref CF_BatchLoaderResult > m_Results = new array< ref CF_BatchLoaderResult >();
+	protected ref CF_BatchLoaderCallback m_Callback;
+
+	protected int m_MaxConcurrent;
+	protected int m_Next;
+	protected int m_Workers;
+	protected int m_Loaded;
+
+	protected bool m_Started;
+
+	void CF_BatchLoader( int maxConcurrent = 4 )
+	{
+		m_MaxConcurrent = Math.Max( maxConcurrent, 1 );
+	}
+
+	void AddXML( string path )
+	{
+		Add( path, true );
+	}
+
+	void AddConfig( string path )
+	{
+		Add( path, false );
+	}
+
+	protected void Add( string path, bool isXML )
+	{
+		if ( m_Started )
+		{
+			Error( "CF_BatchLoader: can't add " + path + " after the loader has started" );
+			return;
+		}
+
+		m_Results.Insert( new CF_BatchLoaderResult( path, isXML ) );
+	}
+
+	/**
+	 * @brief Starts loading, the callback is called once when every file is done
+	 */
+	void Start( CF_BatchLoaderCallback callback = NULL )
+	{
+		if ( m_Started )
+		{
+			Error( "CF_BatchLoader: already started" );
+			return;
+		}
+
+		m_Started = true;
+		m_Callback = callback;
+
+		if ( m_Results.Count() == 0 )
+		{
+			Complete();
+			return;
+		}
+
+		s_Running.Insert( this );
+
+		m_Workers = Math.Min( m_MaxConcurrent, m_Results.Count() );
+		for ( int i = 0; i < m_Workers; i++ )
+		{
+			thread Worker();
+		}
+	}
+
+	bool IsComplete()
+	{
+		return m_Started && m_Loaded == m_Results.Count();
+	}
+
+	int Count()
+	{
+		return m_Results.Count();
+	}
+
+	CF_BatchLoaderResult Get( int index )
+	{
+		return m_Results[index];
+	}
+
+	CF_BatchLoaderResult Find( string path )
+	{
+		for ( int i = 0; i < m_Results.Count(); i++ )
+		{
+			if ( m_Results[i].Path == path )
+				return m_Results[i];
+		}
+
+		return NULL;
+	}
+
+	bool HasErrors()
+	{
+		for ( int i = 0; i < m_Results.Count(); i++ )
+		{
+			if ( !m_Results[i].Success )
+				return true;
+		}
+
+		return false;
+	}
+
+	protected void Worker()
+	{
+		while ( m_Next < m_Results.Count() )
+		{
+			CF_BatchLoaderResult result = m_Results[m_Next];
+			m_Next++;
+
+			Load( result );
+			m_Loaded++;
+
+			//! Give the frame back before the next file
+			Sleep( 1 );
+		}
+
+		m_Workers--;
+		if ( m_Workers == 0 )
+			Complete();
+	}
+
+	protected void Load( CF_BatchLoaderResult result )
+	{
+		if ( !FileExist( result.Path ) )
+		{
+			result.Error = "File does not exist";
+			return;
+		}
+
+		if ( result.IsXML )
+		{
+			CF_XML_Document document;
+			result.Success = CF_XML.ReadDocument( result.Path, document );
+			result.Document = document;
+		} else
+		{
+			ConfigFile config;
+			result.Success = ConfigFile.ParseFile( result.Path, config );
+			result.Config = config;
+		}
+
+		if ( !result.Success )
+			result.Error = "Failed to parse";
+	}
+
+	protected void Complete()
+	{
+		if ( m_Callback )
+			m_Callback.OnComplete( this );
+
+		m_Callback = NULL;
+
+		s_Running.RemoveItem( this );
+	}
+};
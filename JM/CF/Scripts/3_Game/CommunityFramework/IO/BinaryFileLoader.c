@@ -0,0 +1,92 @@
+/**
+ * @brief JsonFileLoader for binary settings files, see CF_BinarySerializer
+ *
+ * @code
+ * class MyTraderSettings
+ * {
+ * 	ref array< ref MyTraderItem > Items;
+ * };
+ *
+ * //! Once, i.e. when the settings are first converted
+ * CF_BinaryFileLoader< MyTraderSettings >.JsonToBinary( "$profile:MyMod/traders.json", "$profile:MyMod/traders.bin" );
+ *
+ * MyTraderSettings settings;
+ * CF_BinaryFileLoader< MyTraderSettings >.LoadFile( "$profile:MyMod/traders.bin", settings );
+ * @endcode
+ */
+class CF_BinaryFileLoader< Class T >
+{
+	/**
+	 * @brief Reads the file onto data, creating data if it is NULL
+	 *
+	 * @return bool			false if the file couldn't be opened or is not a binary settings file
+	 */
+	static bool LoadFile( string path, out T data )
+	{
+		FileSerializer file = new FileSerializer();
+		if ( !file.Open( path, FileMode.READ ) )
+		{
+			Error( "CF_BinaryFileLoader: can't open " + path );
+			return false;
+		}
+
+		if ( !data )
+			data = new T();
+
+		int version;
+		bool success = CF_BinarySerializer.ReadHeader( file, version ) && CF_BinarySerializer.Read( file, data );
+
+		file.Close();
+
+		if ( !success )
+			Error( "CF_BinaryFileLoader: " + path + " is not a valid binary settings file" );
+
+		return success;
+	}
+
+	static bool SaveFile( string path, T data )
+	{
+		if ( !data )
+			return false;
+
+		FileSerializer file = new FileSerializer();
+		if ( !file.Open( path, FileMode.WRITE ) )
+		{
+			Error( "CF_BinaryFileLoader: can't open " + path + " for writing" );
+			return false;
+		}
+
+		bool success = CF_BinarySerializer.WriteHeader( file ) && CF_BinarySerializer.Write( file, data );
+
+		file.Close();
+
+		if ( !success )
+			Error( "CF_BinaryFileLoader: failed to write " + path );
+
+		return success;
+	}
+
+	static bool JsonToBinary( string jsonPath, string binaryPath )
+	{
+		if ( !FileExist( jsonPath ) )
+		{
+			Error( "CF_BinaryFileLoader: " + jsonPath + " does not exist" );
+			return false;
+		}
+
+		T data = new T();
+		JsonFileLoader< T >.JsonLoadFile( jsonPath, data );
+
+		return SaveFile( binaryPath, data );
+	}
+
+	static bool BinaryToJson( string binaryPath, string jsonPath )
+	{
+		T data;
+		if ( !LoadFile( binaryPath, data ) )
+			return false;
+
+		JsonFileLoader< T >.JsonSaveFile( jsonPath, data );
+		return true;
+	}
+};
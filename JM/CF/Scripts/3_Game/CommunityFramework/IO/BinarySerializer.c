@@ -0,0 +1,483 @@
+/**
+ * @brief Writes script objects into a Serializer through reflection, the
+ * binary counterpart of JsonFileLoader. See CF_BinaryFileLoader for files.
+ *
+ * Every field is written as its CF_FieldInfo::NameHash and CF_FieldKind
+ * followed by the value. Fields are matched by hash when reading, so fields
+ * can be added, removed and reordered between versions of a settings class.
+ * Unknown fields and fields whose kind changed are skipped.
+ *
+ * Arrays of bool, int, float, string and vector are written in one call.
+ * Fields of other types, such as maps and nested arrays, are not written.
+ */
+class CF_BinarySerializer
+{
+	//! "CFBN"
+	static const int MAGIC = 0x4E424643;
+	static const int VERSION = 1;
+
+	//! Fields of each type that can be written, in declaration order
+	protected static ref map< typename, ref array< CF_FieldInfo > > s_Layouts = new map< typename, ref array< CF_FieldInfo > >();
+
+	private void CF_BinarySerializer()
+	{
+	}
+
+	/**
+	 * @brief [Internal] CommunityFramework cleanup
+	 */
+	static void _Cleanup()
+	{
+		s_Layouts.Clear();
+	}
+
+	static bool WriteHeader( Serializer ctx )
+	{
+		return ctx.Write( MAGIC ) && ctx.Write( VERSION );
+	}
+
+	/**
+	 * @param version		format version of the file, for future migrations
+	 * @return bool			false if this is not a binary settings file or it is newer than this version of CF
+	 */
+	static bool ReadHeader( Serializer ctx, out int version )
+	{
+		int magic;
+		if ( !ctx.Read( magic ) || magic != MAGIC )
+			return false;
+
+		if ( !ctx.Read( version ) || version > VERSION )
+			return false;
+
+		return true;
+	}
+
+	static bool Write( Serializer ctx, notnull Class target )
+	{
+		array< CF_FieldInfo > layout = GetLayout( target.Type() );
+
+		if ( !ctx.Write( layout.Count() ) )
+			return false;
+
+		for ( int i = 0; i < layout.Count(); i++ )
+		{
+			CF_FieldInfo field = layout[i];
+
+			int kind = field.Kind;
+			if ( !ctx.Write( field.NameHash ) || !ctx.Write( kind ) )
+				return false;
+
+			if ( !WriteField( ctx, target, field ) )
+				return false;
+		}
+
+		return true;
+	}
+
+	static bool Read( Serializer ctx, notnull Class target )
+	{
+		CF_TypeInfo info = CF_TypeInfo.Get( target.Type() );
+
+		int count;
+		if ( !ctx.Read( count ) )
+			return false;
+
+		for ( int i = 0; i < count; i++ )
+		{
+			int nameHash;
+			int kind;
+			if ( !ctx.Read( nameHash ) || !ctx.Read( kind ) )
+				return false;
+
+			CF_FieldInfo field = info.FindFieldByHash( nameHash );
+			if ( !field || field.Kind != kind )
+			{
+				//! Removed from the class or changed its type since the file was written
+				if ( !Skip( ctx, kind ) )
+					return false;
+
+				continue;
+			}
+
+			if ( !ReadField( ctx, target, field ) )
+				return false;
+		}
+
+		return true;
+	}
+
+	protected static array< CF_FieldInfo > GetLayout( typename type )
+	{
+		array< CF_FieldInfo > layout;
+		if ( s_Layouts.Find( type, layout ) )
+			return layout;
+
+		layout = new array< CF_FieldInfo >();
+
+		CF_TypeInfo info = CF_TypeInfo.Get( type );
+		for ( int i = 0; i < info.Fields.Count(); i++ )
+		{
+			CF_FieldInfo field = info.Fields[i];
+			if ( field.Kind == CF_FieldKind.UNKNOWN )
+				continue;
+
+			if ( field.Kind == CF_FieldKind.ARRAY && ( field.ElementKind == CF_FieldKind.UNKNOWN || field.ElementKind == CF_FieldKind.ARRAY ) )
+				continue;
+
+			layout.Insert( field );
+		}
+
+		s_Layouts.Insert( type, layout );
+		return layout;
+	}
+
+	protected static bool WriteField( Serializer ctx, Class target, CF_FieldInfo field )
+	{
+		switch ( field.Kind )
+		{
+		case CF_FieldKind.BOOL:
+			bool boolValue;
+			EnScript.GetClassVar( target, field.Name, 0, boolValue );
+			return ctx.Write( boolValue );
+		case CF_FieldKind.INT:
+			int intValue;
+			EnScript.GetClassVar( target, field.Name, 0, intValue );
+			return ctx.Write( intValue );
+		case CF_FieldKind.FLOAT:
+			float floatValue;
+			EnScript.GetClassVar( target, field.Name, 0, floatValue );
+			return ctx.Write( floatValue );
+		case CF_FieldKind.STRING:
+			string stringValue;
+			EnScript.GetClassVar( target, field.Name, 0, stringValue );
+			return ctx.Write( stringValue );
+		case CF_FieldKind.VECTOR:
+			vector vectorValue;
+			EnScript.GetClassVar( target, field.Name, 0, vectorValue );
+			return ctx.Write( vectorValue );
+		case CF_FieldKind.CLASS:
+			Class child;
+			EnScript.GetClassVar( target, field.Name, 0, child );
+			return WriteObject( ctx, child );
+		case CF_FieldKind.ARRAY:
+			Class arr;
+			EnScript.GetClassVar( target, field.Name, 0, arr );
+			return WriteArray( ctx, arr, field.ElementKind );
+		}
+
+		return false;
+	}
+
+	protected static bool WriteObject( Serializer ctx, Class value )
+	{
+		if ( !ctx.Write( value != NULL ) )
+			return false;
+
+		if ( !value )
+			return true;
+
+		return Write( ctx, value );
+	}
+
+	protected static bool WriteArray( Serializer ctx, Class arr, int elementKind )
+	{
+		if ( !ctx.Write( arr != NULL ) )
+			return false;
+
+		if ( !arr )
+			return true;
+
+		if ( !ctx.Write( elementKind ) )
+			return false;
+
+		switch ( elementKind )
+		{
+		case CF_FieldKind.BOOL:
+			return ctx.Write( array< bool >.Cast( arr ) );
+		case CF_FieldKind.INT:
+			return ctx.Write( array< int >.Cast( arr ) );
+		case CF_FieldKind.FLOAT:
+			return ctx.Write( array< float >.Cast( arr ) );
+		case CF_FieldKind.STRING:
+			return ctx.Write( array< string >.Cast( arr ) );
+		case CF_FieldKind.VECTOR:
+			return ctx.Write( array< vector >.Cast( arr ) );
+		}
+
+		int count;
+		g_Script.CallFunction( arr, "Count", count, NULL );
+
+		if ( !ctx.Write( count ) )
+			return false;
+
+		for ( int i = 0; i < count; i++ )
+		{
+			Class element;
+			g_Script.CallFunction( arr, "Get", element, i );
+
+			if ( !WriteObject( ctx, element ) )
+				return false;
+		}
+
+		return true;
+	}
+
+	protected static bool ReadField( Serializer ctx, Class target, CF_FieldInfo field )
+	{
+		switch ( field.Kind )
+		{
+		case CF_FieldKind.BOOL:
+			bool boolValue;
+			if ( !ctx.Read( boolValue ) )
+				return false;
+
+			EnScript.SetClassVar( target, field.Name, 0, boolValue );
+			return true;
+		case CF_FieldKind.INT:
+			int intValue;
+			if ( !ctx.Read( intValue ) )
+				return false;
+
+			EnScript.SetClassVar( target, field.Name, 0, intValue );
+			return true;
+		case CF_FieldKind.FLOAT:
+			float floatValue;
+			if ( !ctx.Read( floatValue ) )
+				return false;
+
+			EnScript.SetClassVar( target, field.Name, 0, floatValue );
+			return true;
+		case CF_FieldKind.STRING:
+			string stringValue;
+			if ( !ctx.Read( stringValue ) )
+				return false;
+
+			EnScript.SetClassVar( target, field.Name, 0, stringValue );
+			return true;
+		case CF_FieldKind.VECTOR:
+			vector vectorValue;
+			if ( !ctx.Read( vectorValue ) )
+				return false;
+
+			EnScript.SetClassVar( target, field.Name, 0, vectorValue );
+			return true;
+		case CF_FieldKind.CLASS:
+			return ReadObjectField( ctx, target, field );
+		case CF_FieldKind.ARRAY:
+			return ReadArrayField( ctx, target, field );
+		}
+
+		return false;
+	}
+
+	//! Null in the file keeps the default value of the field
+	protected static bool ReadObjectField( Serializer ctx, Class target, CF_FieldInfo field )
+	{
+		bool present;
+		if ( !ctx.Read( present ) )
+			return false;
+
+		if ( !present )
+			return true;
+
+		Class child;
+		EnScript.GetClassVar( target, field.Name, 0, child );
+		if ( !child )
+		{
+			child = field.Type.Spawn();
+			if ( !child )
+				return SkipObjectFields( ctx );
+
+			EnScript.SetClassVar( target, field.Name, 0, child );
+		}
+
+		return Read( ctx, child );
+	}
+
+	protected static bool ReadArrayField( Serializer ctx, Class target, CF_FieldInfo field )
+	{
+		bool present;
+		if ( !ctx.Read( present ) )
+			return false;
+
+		if ( !present )
+			return true;
+
+		int elementKind;
+		if ( !ctx.Read( elementKind ) )
+			return false;
+
+		if ( elementKind != field.ElementKind )
+			return SkipArray( ctx, elementKind );
+
+		Class arr;
+		EnScript.GetClassVar( target, field.Name, 0, arr );
+		if ( !arr )
+		{
+			arr = field.Type.Spawn();
+			if ( !arr )
+				return SkipArray( ctx, elementKind );
+
+			EnScript.SetClassVar( target, field.Name, 0, arr );
+		}
+
+		switch ( elementKind )
+		{
+		case CF_FieldKind.BOOL:
+			array< bool > bools = array< bool >.Cast( arr );
+			return ctx.Read( bools );
+		case CF_FieldKind.INT:
+			array< int > ints = array< int >.Cast( arr );
+			return ctx.Read( ints );
+		case CF_FieldKind.FLOAT:
+			array< float > floats = array< float >.Cast( arr );
+			return ctx.Read( floats );
+		case CF_FieldKind.STRING:
+			array< string > strings = array< string >.Cast( arr );
+			return ctx.Read( strings );
+		case CF_FieldKind.VECTOR:
+			array< vector > vectors = array< vector >.Cast( arr );
+			return ctx.Read( vectors );
+		}
+
+		int count;
+		if ( !ctx.Read( count ) )
+			return false;
+
+		g_Script.CallFunctionParams( arr, "Clear", NULL, NULL );
+
+		for ( int i = 0; i < count; i++ )
+		{
+			bool elementPresent;
+			if ( !ctx.Read( elementPresent ) )
+				return false;
+
+			Class element = NULL;
+			if ( elementPresent )
+			{
+				element = field.ElementType.Spawn();
+				if ( !element )
+				{
+					if ( !SkipObjectFields( ctx ) )
+						return false;
+
+					continue;
+				}
+
+				if ( !Read( ctx, element ) )
+					return false;
+			}
+
+			g_Script.CallFunction( arr, "Insert", NULL, element );
+		}
+
+		return true;
+	}
+
+	protected static bool Skip( Serializer ctx, int kind )
+	{
+		switch ( kind )
+		{
+		case CF_FieldKind.BOOL:
+			bool boolValue;
+			return ctx.Read( boolValue );
+		case CF_FieldKind.INT:
+			int intValue;
+			return ctx.Read( intValue );
+		case CF_FieldKind.FLOAT:
+			float floatValue;
+			return ctx.Read( floatValue );
+		case CF_FieldKind.STRING:
+			string stringValue;
+			return ctx.Read( stringValue );
+		case CF_FieldKind.VECTOR:
+			vector vectorValue;
+			return ctx.Read( vectorValue );
+		case CF_FieldKind.CLASS:
+			return SkipObject( ctx );
+		case CF_FieldKind.ARRAY:
+			bool present;
+			if ( !ctx.Read( present ) )
+				return false;
+
+			if ( !present )
+				return true;
+
+			int elementKind;
+			if ( !ctx.Read( elementKind ) )
+				return false;
+
+			return SkipArray( ctx, elementKind );
+		}
+
+		Error( "CF_BinarySerializer: unknown field kind " + kind.ToString() + ", the file is corrupted" );
+		return false;
+	}
+
+	protected static bool SkipObject( Serializer ctx )
+	{
+		bool present;
+		if ( !ctx.Read( present ) )
+			return false;
+
+		if ( !present )
+			return true;
+
+		return SkipObjectFields( ctx );
+	}
+
+	protected static bool SkipObjectFields( Serializer ctx )
+	{
+		int count;
+		if ( !ctx.Read( count ) )
+			return false;
+
+		for ( int i = 0; i < count; i++ )
+		{
+			int nameHash;
+			int kind;
+			if ( !ctx.Read( nameHash ) || !ctx.Read( kind ) )
+				return false;
+
+			if ( !Skip( ctx, kind ) )
+				return false;
+		}
+
+		return true;
+	}
+
+	//! After the present flag and element kind
+	protected static bool SkipArray( Serializer ctx, int elementKind )
+	{
+		switch ( elementKind )
+		{
+		case CF_FieldKind.BOOL:
+			array< bool > bools = new array< bool >();
+			return ctx.Read( bools );
+		case CF_FieldKind.INT:
+			array< int > ints = new array< int >();
+			return ctx.Read( ints );
+		case CF_FieldKind.FLOAT:
+			array< float > floats = new array< float >();
+			return ctx.Read( floats );
+		case CF_FieldKind.STRING:
+			array< string > strings = new array< string >();
+			return ctx.Read( strings );
+		case CF_FieldKind.VECTOR:
+			array< vector > vectors = new array< vector >();
+			return ctx.Read( vectors );
+		}
+
+		int count;
+		if ( !ctx.Read( count ) )
+			return false;
+
+		for ( int i = 0; i < count; i++ )
+		{
+			if ( !SkipObject( ctx ) )
+				return false;
+		}
+
+		return true;
+	}
+};
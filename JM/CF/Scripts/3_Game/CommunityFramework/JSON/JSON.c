@@ -0,0 +1,162 @@
+class CF_JSON_Callback : Managed
+{
+	void OnStart( CF_JSON_Reader reader );
+
+	/**
+	 * @brief Called for every token, return false to stop reading
+	 */
+	bool OnToken( CF_JSON_Reader reader )
+	{
+		return true;
+	}
+
+	//! Also called when OnToken stopped the reader
+	void OnSuccess( CF_JSON_Reader reader );
+
+	void OnFailure( CF_JSON_Reader reader, string error );
+};
+
+/**
+ * @brief Streaming JSON, the counterpart of CF_XML for files too big to load
+ * with JsonFileLoader. See CF_JSON_Reader and CF_JSON_Writer.
+ *
+ * @code
+ * class MyExportCallback : CF_JSON_Callback
+ * {
+ * 	override bool OnToken( CF_JSON_Reader reader )
+ * 	{
+ * 		if ( reader.GetToken() == CF_JSON_Token.PROPERTY_NAME && reader.GetString() == "classname" )
+ * 		{
+ * 			reader.Read();
+ * 			m_ClassNames.Insert( reader.GetString() );
+ * 		}
+ *
+ * 		return true;
+ * 	}
+ * };
+ *
+ * CF.JSON.ReadAsync( "$profile:MyMod/export.json", new MyExportCallback() );
+ * @endcode
+ */
+class CF_JSON
+{
+	static const int TICKS_PER_MS = 10000;
+
+	//! Keeps callbacks alive while their threads run
+	protected static ref array< ref CF_JSON_Callback > s_Running = new array< ref CF_JSON_Callback >();
+
+	//! Milliseconds ReadAsync may spend per frame
+	protected static float s_Budget = 2.0;
+
+	//!Single static instance. Do not create with new or spawn - use CF.JSON for access instead.
+	protected void CF_JSON();
+	protected void ~CF_JSON();
+
+	/**
+	 * @brief [Internal] CommunityFramework cleanup
+	 */
+	static void _Cleanup()
+	{
+		s_Running.Clear();
+	}
+
+	/**
+	 * @brief NULL if the file couldn't be opened
+	 */
+	static CF_JSON_Reader Open( string path )
+	{
+		FileHandle handle = OpenFile( path, FileMode.READ );
+		if ( handle == 0 )
+		{
+			Error( "CF_JSON: can't open " + path );
+			return NULL;
+		}
+
+		return new CF_JSON_Reader( handle );
+	}
+
+	static CF_JSON_Reader Parse( string text )
+	{
+		return new CF_JSON_Reader( 0, text );
+	}
+
+	/**
+	 * @brief NULL if the file couldn't be opened, Close the writer to finish the file
+	 */
+	static CF_JSON_Writer Create( string path, bool pretty = false )
+	{
+		FileHandle handle = OpenFile( path, FileMode.WRITE );
+		if ( handle == 0 )
+		{
+			Error( "CF_JSON: can't open " + path + " for writing" );
+			return NULL;
+		}
+
+		return new CF_JSON_Writer( handle, pretty );
+	}
+
+	/**
+	 * @brief Runs the whole file through the callback now
+	 */
+	static void Read( string path, notnull CF_JSON_Callback callback )
+	{
+		Process( Open( path ), callback, false );
+	}
+
+	/**
+	 * @brief Runs the file through the callback in a script thread, a few milliseconds per frame
+	 */
+	static void ReadAsync( string path, notnull CF_JSON_Callback callback )
+	{
+		s_Running.Insert( callback );
+
+		thread Process( Open( path ), callback, true );
+	}
+
+	static void SetBudget( float milliseconds )
+	{
+		s_Budget = milliseconds;
+	}
+
+	static float GetBudget()
+	{
+		return s_Budget;
+	}
+
+	protected static void Process( CF_JSON_Reader reader, CF_JSON_Callback callback, bool async )
+	{
+		if ( !reader )
+		{
+			callback.OnFailure( NULL, "Failed to open file" );
+			s_Running.RemoveItem( callback );
+			return;
+		}
+
+		callback.OnStart( reader );
+
+		int start = TickCount( 0 );
+		while ( reader.Read() )
+		{
+			if ( !callback.OnToken( reader ) )
+				break;
+
+			if ( async && TickCount( start ) > s_Budget * TICKS_PER_MS )
+			{
+				Sleep( 1 );
+				start = TickCount( 0 );
+			}
+		}
+
+		if ( reader.HasError() )
+		{
+			callback.OnFailure( reader, reader.GetError() );
+		} else
+		{
+			callback.OnSuccess( reader );
+		}
+
+		reader.Close();
+
+		s_Running.RemoveItem( callback );
+	}
+};
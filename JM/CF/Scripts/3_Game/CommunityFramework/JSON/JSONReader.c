@@ -0,0 +1,480 @@
+enum CF_JSON_Token
+{
+	NONE = 0,
+	BEGIN_OBJECT,
+	END_OBJECT,
+	BEGIN_ARRAY,
+	END_ARRAY,
+	PROPERTY_NAME,
+	STRING,
+	NUMBER,
+	BOOL,
+	NULL_VALUE,
+	END_OF_FILE,
+	ERROR
+};
+
+/**
+ * @brief Pull based JSON tokenizer, the file is read in chunks of CHUNK_SIZE
+ * characters so only the current chunk and the nesting of the current token
+ * are held in memory, even for minified files that are a single line.
+ *
+ * @code
+ * CF_JSON_Reader reader = CF.JSON.Open( "$profile:MyMod/export.json" );
+ * while ( reader.Read() )
+ * {
+ * 	if ( reader.GetToken() == CF_JSON_Token.PROPERTY_NAME && reader.GetString() == "version" )
+ * 	{
+ * 		reader.Read();
+ * 		version = reader.GetInt();
+ * 		break;
+ * 	}
+ * }
+ * reader.Close();
+ * @endcode
+ */
+class CF_JSON_Reader : Managed
+{
+	static const int CONTAINER_OBJECT = 0;
+	static const int CONTAINER_ARRAY = 1;
+
+	static const int CHUNK_SIZE = 4096;
+
+	protected FileHandle m_File;
+
+	//! Unread input, the file is appended a chunk at a time
+	protected string m_Buffer;
+	protected int m_Position;
+	protected int m_LineNumber = 1;
+
+	//! Nothing left to append to the buffer
+	protected bool m_EOF;
+
+	protected ref array< int > m_Containers = new array< int >();
+	protected bool m_ExpectName;
+
+	protected CF_JSON_Token m_Token;
+	protected string m_Value;
+	protected string m_Error;
+
+	/**
+	 * @param file	read in chunks, or 0 to read text
+	 * @param text	the whole input when there is no file
+	 */
+	void CF_JSON_Reader( FileHandle file = 0, string text = "" )
+	{
+		m_File = file;
+		m_Buffer = text;
+
+		if ( m_File == 0 )
+			m_EOF = true;
+	}
+
+	void ~CF_JSON_Reader()
+	{
+		Close();
+	}
+
+	void Close()
+	{
+		if ( m_File != 0 )
+			CloseFile( m_File );
+
+		m_File = 0;
+		m_EOF = true;
+	}
+
+	/**
+	 * @brief Advances to the next token, false at the end of the file or on a syntax error
+	 */
+	bool Read()
+	{
+		if ( m_Token == CF_JSON_Token.ERROR || m_Token == CF_JSON_Token.END_OF_FILE )
+			return false;
+
+		m_Value = string.Empty;
+
+		string c = NextSignificantChar();
+		while ( c == "," || c == ":" )
+			c = NextSignificantChar();
+
+		if ( c == string.Empty )
+		{
+			if ( m_Containers.Count() > 0 )
+				return Fail( "Unexpected end of file" );
+
+			m_Token = CF_JSON_Token.END_OF_FILE;
+			return false;
+		}
+
+		switch ( c )
+		{
+		case "{":
+			m_Containers.Insert( CONTAINER_OBJECT );
+			m_ExpectName = true;
+			m_Token = CF_JSON_Token.BEGIN_OBJECT;
+			return true;
+		case "[":
+			m_Containers.Insert( CONTAINER_ARRAY );
+			m_ExpectName = false;
+			m_Token = CF_JSON_Token.BEGIN_ARRAY;
+			return true;
+		case "}":
+			if ( !PopContainer( CONTAINER_OBJECT ) )
+				return Fail( "Unexpected }" );
+
+			m_Token = CF_JSON_Token.END_OBJECT;
+			return true;
+		case "]":
+			if ( !PopContainer( CONTAINER_ARRAY ) )
+				return Fail( "Unexpected ]" );
+
+			m_Token = CF_JSON_Token.END_ARRAY;
+			return true;
+		case "\"":
+			if ( !ReadString() )
+				return false;
+
+			if ( m_ExpectName )
+			{
+				m_ExpectName = false;
+				m_Token = CF_JSON_Token.PROPERTY_NAME;
+				return true;
+			}
+
+			m_Token = CF_JSON_Token.STRING;
+			OnValue();
+			return true;
+		case "t":
+			return ReadLiteral( "true", CF_JSON_Token.BOOL );
+		case "f":
+			return ReadLiteral( "false", CF_JSON_Token.BOOL );
+		case "n":
+			return ReadLiteral( "null", CF_JSON_Token.NULL_VALUE );
+		}
+
+		if ( c == "-" || IsDigit( c ) )
+			return ReadNumber( c );
+
+		return Fail( "Unexpected character " + c );
+	}
+
+	CF_JSON_Token GetToken()
+	{
+		return m_Token;
+	}
+
+	//! Property name, string value or the text of a number or literal
+	string GetString()
+	{
+		return m_Value;
+	}
+
+	int GetInt()
+	{
+		return m_Value.ToInt();
+	}
+
+	float GetFloat()
+	{
+		return m_Value.ToFloat();
+	}
+
+	bool GetBool()
+	{
+		return m_Value == "true";
+	}
+
+	bool IsValue()
+	{
+		return m_Token == CF_JSON_Token.STRING || m_Token == CF_JSON_Token.NUMBER || m_Token == CF_JSON_Token.BOOL || m_Token == CF_JSON_Token.NULL_VALUE;
+	}
+
+	//! Number of objects and arrays the reader is inside of
+	int GetDepth()
+	{
+		return m_Containers.Count();
+	}
+
+	int GetLineNumber()
+	{
+		return m_LineNumber;
+	}
+
+	string GetError()
+	{
+		return m_Error;
+	}
+
+	bool HasError()
+	{
+		return m_Token == CF_JSON_Token.ERROR;
+	}
+
+	/**
+	 * @brief Skips the value of the current property name or the object or array
+	 * that was just entered, without storing anything
+	 */
+	bool Skip()
+	{
+		if ( m_Token == CF_JSON_Token.PROPERTY_NAME && !Read() )
+			return false;
+
+		if ( m_Token != CF_JSON_Token.BEGIN_OBJECT && m_Token != CF_JSON_Token.BEGIN_ARRAY )
+			return true;
+
+		int depth = GetDepth();
+		while ( GetDepth() >= depth )
+		{
+			if ( !Read() )
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Reads up to the property with the given name in the current object, false if the object ends first
+	 */
+	bool FindProperty( string name )
+	{
+		int depth = GetDepth();
+
+		while ( Read() )
+		{
+			if ( GetDepth() < depth )
+				return false;
+
+			if ( m_Token != CF_JSON_Token.PROPERTY_NAME )
+				continue;
+
+			if ( m_Value == name )
+				return true;
+
+			if ( !Skip() )
+				return false;
+		}
+
+		return false;
+	}
+
+	protected void OnValue()
+	{
+		int count = m_Containers.Count();
+		m_ExpectName = count > 0 && m_Containers[count - 1] == CONTAINER_OBJECT;
+	}
+
+	protected bool PopContainer( int container )
+	{
+		int count = m_Containers.Count();
+		if ( count == 0 || m_Containers[count - 1] != container )
+			return false;
+
+		m_Containers.Remove( count - 1 );
+		OnValue();
+		return true;
+	}
+
+	protected bool Fail( string message )
+	{
+		m_Token = CF_JSON_Token.ERROR;
+		m_Error = "[" + m_LineNumber.ToString() + "] " + message;
+		return false;
+	}
+
+	//! Empty at the end of the input
+	protected string NextChar()
+	{
+		if ( !Ensure( 1 ) )
+			return string.Empty;
+
+		string c = m_Buffer.Get( m_Position );
+		m_Position++;
+		return c;
+	}
+
+	//! False if the input ends before count more characters
+	protected bool Ensure( int count )
+	{
+		while ( m_Buffer.Length() - m_Position < count )
+		{
+			if ( !Fill() )
+				return false;
+		}
+
+		return true;
+	}
+
+	//! Appends the next chunk of the file, dropping what was already read from the buffer
+	protected bool Fill()
+	{
+		if ( m_EOF )
+			return false;
+
+		string chunk;
+		if ( ReadFile( m_File, chunk, CHUNK_SIZE ) <= 0 )
+		{
+			m_EOF = true;
+			return false;
+		}
+
+		m_Buffer = m_Buffer.Substring( m_Position, m_Buffer.Length() - m_Position ) + chunk;
+		m_Position = 0;
+		return true;
+	}
+
+	protected string NextSignificantChar()
+	{
+		string c = NextChar();
+		while ( c == " " || c == "\t" || c == "\n" || c == "\r" )
+		{
+			if ( c == "\n" )
+				m_LineNumber++;
+
+			c = NextChar();
+		}
+
+		return c;
+	}
+
+	protected bool ReadString()
+	{
+		string c;
+		string escaped;
+
+		//! Copies runs without escapes in one Substring, a run ends at an escape or the end of the chunk
+		while ( true )
+		{
+			int start = m_Position;
+			int length = m_Buffer.Length();
+			while ( m_Position < length )
+			{
+				c = m_Buffer.Get( m_Position );
+				if ( c == "\"" || c == "\\" )
+					break;
+
+				m_Position++;
+			}
+
+			m_Value += m_Buffer.Substring( start, m_Position - start );
+
+			if ( m_Position >= length )
+			{
+				if ( !Fill() )
+					return Fail( "Unterminated string" );
+
+				continue;
+			}
+
+			m_Position++;
+
+			if ( c == "\"" )
+				return true;
+
+			if ( !Ensure( 1 ) )
+				return Fail( "Unterminated string" );
+
+			escaped = m_Buffer.Get( m_Position );
+			m_Position++;
+
+			switch ( escaped )
+			{
+			case "n":
+				m_Value += "\n";
+				break;
+			case "t":
+				m_Value += "\t";
+				break;
+			case "r":
+				m_Value += "\r";
+				break;
+			case "b":
+				break;
+			case "f":
+				break;
+			case "u":
+				if ( !Ensure( 4 ) )
+					return Fail( "Invalid unicode escape" );
+
+				m_Value += DecodeUnicode( m_Buffer.Substring( m_Position, 4 ) );
+				m_Position += 4;
+				break;
+			default:
+				m_Value += escaped;
+				break;
+			}
+		}
+
+		return false;
+	}
+
+	//! Printable ASCII only, anything else becomes ?
+	protected string DecodeUnicode( string hex )
+	{
+		hex.ToLower();
+
+		int code = 0;
+		for ( int i = 0; i < hex.Length(); i++ )
+		{
+			int digit = "0123456789abcdef".IndexOf( hex.Get( i ) );
+			if ( digit == -1 )
+				return "?";
+
+			code = code * 16 + digit;
+		}
+
+		if ( code < 32 || code > 126 )
+			return "?";
+
+		return _cf_characters[code - 32];
+	}
+
+	protected bool ReadLiteral( string literal, CF_JSON_Token token )
+	{
+		m_Value = literal.Get( 0 );
+		for ( int i = 1; i < literal.Length(); i++ )
+			m_Value += NextChar();
+
+		if ( m_Value != literal )
+			return Fail( "Unexpected " + m_Value );
+
+		m_Token = token;
+		OnValue();
+		return true;
+	}
+
+	protected bool ReadNumber( string first )
+	{
+		m_Value = first;
+
+		string c;
+		while ( true )
+		{
+			int start = m_Position;
+			int length = m_Buffer.Length();
+			while ( m_Position < length )
+			{
+				c = m_Buffer.Get( m_Position );
+				if ( !IsDigit( c ) && c != "." && c != "e" && c != "E" && c != "+" && c != "-" )
+					break;
+
+				m_Position++;
+			}
+
+			m_Value += m_Buffer.Substring( start, m_Position - start );
+
+			//! The number may continue in the next chunk
+			if ( m_Position < length || !Fill() )
+				break;
+		}
+
+		m_Token = CF_JSON_Token.NUMBER;
+		OnValue();
+		return true;
+	}
+
+	protected bool IsDigit( string c )
+	{
+		return c.Length() == 1 && "0123456789".IndexOf( c ) != -1;
+	}
+};
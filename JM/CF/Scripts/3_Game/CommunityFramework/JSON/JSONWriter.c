@@ -0,0 +1,241 @@
+/**
+ * @brief Writes JSON straight to a file as it is produced, output is buffered
+ * and written in chunks so nothing but the buffer is held in memory.
+ *
+ * @code
+ * CF_JSON_Writer writer = CF.JSON.Create( "$profile:MyMod/export.json" );
+ * writer.BeginObject();
+ * writer.WriteName( "players" );
+ * writer.BeginArray();
+ * foreach ( MyPlayer player : m_Players )
+ * {
+ * 	writer.BeginObject();
+ * 	writer.WriteName( "name" );
+ * 	writer.WriteString( player.Name );
+ * 	writer.EndObject();
+ * }
+ * writer.EndArray();
+ * writer.EndObject();
+ * writer.Close();
+ * @endcode
+ */
+class CF_JSON_Writer : Managed
+{
+	static const int BUFFER_SIZE = 4096;
+
+	protected FileHandle m_File;
+	protected bool m_Pretty;
+
+	protected string m_Buffer;
+
+	//! Per open object or array, true once it has an element
+	protected ref array< bool > m_HasElements = new array< bool >();
+	protected bool m_AfterName;
+
+	void CF_JSON_Writer( FileHandle file, bool pretty = false )
+	{
+		m_File = file;
+		m_Pretty = pretty;
+	}
+
+	void ~CF_JSON_Writer()
+	{
+		Close();
+	}
+
+	/**
+	 * @brief Writes what is left in the buffer and closes the file
+	 */
+	void Close()
+	{
+		if ( m_File == 0 )
+			return;
+
+		if ( m_HasElements.Count() > 0 )
+			Error( "CF_JSON_Writer: closed with " + m_HasElements.Count().ToString() + " objects or arrays still open" );
+
+		Flush();
+
+		CloseFile( m_File );
+		m_File = 0;
+	}
+
+	void Flush()
+	{
+		if ( m_File == 0 || m_Buffer == string.Empty )
+			return;
+
+		FPrint( m_File, m_Buffer );
+		m_Buffer = string.Empty;
+	}
+
+	void BeginObject()
+	{
+		BeginValue();
+		Append( "{" );
+		m_HasElements.Insert( false );
+	}
+
+	void EndObject()
+	{
+		End( "}" );
+	}
+
+	void BeginArray()
+	{
+		BeginValue();
+		Append( "[" );
+		m_HasElements.Insert( false );
+	}
+
+	void EndArray()
+	{
+		End( "]" );
+	}
+
+	void WriteName( string name )
+	{
+		BeginValue();
+		Append( Quote( name ) );
+
+		if ( m_Pretty )
+		{
+			Append( ": " );
+		} else
+		{
+			Append( ":" );
+		}
+
+		m_AfterName = true;
+	}
+
+	void WriteString( string value )
+	{
+		BeginValue();
+		Append( Quote( value ) );
+	}
+
+	void WriteInt( int value )
+	{
+		BeginValue();
+		Append( value.ToString() );
+	}
+
+	void WriteFloat( float value )
+	{
+		BeginValue();
+		Append( value.ToString() );
+	}
+
+	void WriteBool( bool value )
+	{
+		BeginValue();
+
+		if ( value )
+		{
+			Append( "true" );
+		} else
+		{
+			Append( "false" );
+		}
+	}
+
+	void WriteNull()
+	{
+		BeginValue();
+		Append( "null" );
+	}
+
+	//! Separator and indentation before a name or a value that is not after a name
+	protected void BeginValue()
+	{
+		if ( m_AfterName )
+		{
+			m_AfterName = false;
+			return;
+		}
+
+		int count = m_HasElements.Count();
+		if ( count == 0 )
+			return;
+
+		if ( m_HasElements[count - 1] )
+			Append( "," );
+
+		m_HasElements[count - 1] = true;
+
+		if ( m_Pretty )
+			Append( "\n" + CF_Indent( count ) );
+	}
+
+	protected void End( string close )
+	{
+		int count = m_HasElements.Count();
+		if ( count == 0 )
+		{
+			Error( "CF_JSON_Writer: " + close + " without an open object or array" );
+			return;
+		}
+
+		bool hasElements = m_HasElements[count - 1];
+		m_HasElements.Remove( count - 1 );
+
+		if ( m_Pretty && hasElements )
+			Append( "\n" + CF_Indent( count - 1 ) );
+
+		Append( close );
+	}
+
+	protected void Append( string text )
+	{
+		m_Buffer += text;
+
+		if ( m_Buffer.Length() >= BUFFER_SIZE )
+			Flush();
+	}
+
+	static string Quote( string value )
+	{
+		string quoted = "\"";
+
+		//! Copies runs without escapes in one Substring
+		int start = 0;
+		int length = value.Length();
+		for ( int i = 0; i < length; i++ )
+		{
+			string escaped = Escape( value.Get( i ) );
+			if ( escaped == string.Empty )
+				continue;
+
+			quoted += value.Substring( start, i - start ) + escaped;
+			start = i + 1;
+		}
+
+		return quoted + value.Substring( start, length - start ) + "\"";
+	}
+
+	//! Empty if the character can be written as is
+	protected static string Escape( string c )
+	{
+		switch ( c )
+		{
+		case "\\":
+			return "\\\\";
+		case "\"":
+			return "\\\"";
+		case "\n":
+			return "\\n";
+		case "\r":
+			return "\\r";
+		case "\t":
+			return "\\t";
+		}
+
+		//! Other control characters are not allowed in JSON strings
+		int code = c.ToAscii();
+		if ( code >= 0 && code < 32 )
+			return "\\u00" + "0123456789abcdef".Get( code / 16 ) + "0123456789abcdef".Get( code % 16 );
+
+		return string.Empty;
+	}
+};
@@ -61,9 +61,9 @@ class Controller : ScriptedViewBase
 		return m_DataBindingHashMap;
 	}
 
-	// Hashmap of all properties in the Controller
+	// Hashmap of all properties in the Controller, shared by every instance of the type
 	[NonSerialized()]
-	protected autoptr PropertyTypeHashMap m_PropertyTypeHashMap = PropertyTypeHashMap.FromType(Type());
+	protected PropertyTypeHashMap m_PropertyTypeHashMap = PropertyTypeHashMap.GetCached(Type());
 	typename GetPropertyType(string propertyName)
 	{
 		return m_PropertyTypeHashMap.Get(propertyName);
@@ -76,7 +76,14 @@ class Controller : ScriptedViewBase
 		//m_PropertyTypeHashMap.RemoveType(Controller); crashing?
 
 		// Load all child Widgets and obtain their DataBinding class
-		int binding_count = LoadDataBindings(m_LayoutRoot);
+		// Layouts with a manifest from the Workbench plugin skip walking the widget tree
+		int binding_count;
+		ViewBindingManifestScope manifest = ViewBindingManifest.Find(ViewBindingManifest.GetCurrentLayout(), Type(), m_LayoutRoot.GetName());
+		if (!manifest || !LoadDataBindings(manifest, binding_count))
+		{
+			binding_count = LoadDataBindings(m_LayoutRoot);
+		}
+
 		Log("%1: %2 DataBindings found!", m_LayoutRoot.GetName(), binding_count.ToString());
 	}
 
@@ -107,7 +114,7 @@ class Controller : ScriptedViewBase
 				foreach (ViewBinding viewBinding : viewArray)
 				{
 					Trace("NotifyPropertyChanged %1", viewBinding.Binding_Name);
-					viewBinding.UpdateView(this);
+					ViewUpdateQueue.UpdateView(viewBinding, this);
 					PropertyChanged(viewBinding.Binding_Name);
 				}
 			}
@@ -118,10 +125,18 @@ class Controller : ScriptedViewBase
 		ViewBindingArray views = m_DataBindingHashMap[property_name];
 		if (views)
 		{
+			#ifdef CF_PROFILER
+			CF_Profiler.Begin("Controller::NotifyPropertyChanged");
+			#endif
+
 			foreach (ViewBinding view : views)
 			{
-				view.UpdateView(this);
+				ViewUpdateQueue.UpdateView(view, this);
 			}
+
+			#ifdef CF_PROFILER
+			CF_Profiler.End();
+			#endif
 		}
 
 		if (notify_controller)
@@ -146,10 +161,18 @@ class Controller : ScriptedViewBase
 
 		if (views)
 		{
+			#ifdef CF_PROFILER
+			CF_Profiler.Begin("Controller::NotifyCollectionChanged");
+			#endif
+
 			foreach (ViewBinding view : views)
 			{
-				view.UpdateViewFromCollection(args);
+				ViewUpdateQueue.UpdateViewFromCollection(view, this, args);
 			}
+
+			#ifdef CF_PROFILER
+			CF_Profiler.End();
+			#endif
 		}
 
 		CollectionChanged(collection_name, args);
@@ -163,46 +186,98 @@ class Controller : ScriptedViewBase
 	// Override this when you want to have an event AFTER collection is changed
 	void CollectionChanged(string collection_name, CollectionChangedEventArgs args);
 
-	private int LoadDataBindings(Widget w)
+	// Returns false if the manifest does not match the layout anymore
+	private bool LoadDataBindings(ViewBindingManifestScope manifest, out int binding_count)
 	{
-		ScriptedViewBase viewBase;
-		w.GetScript(viewBase);
-
-		// If we find a ViewBinding
-		if (viewBase && viewBase.IsInherited(ViewBinding))
+		array<ViewBinding> viewBindings = {};
+		foreach (ViewPropertyPath bindingPath : manifest.Bindings)
 		{
-			ViewBinding viewBinding = ViewBinding.Cast(viewBase);
-			viewBinding.SetParent(this);
-			m_ViewBindingHashMap.Insert(w, viewBinding);
-			m_DataBindingHashMap.InsertView(viewBinding);
+			ViewBinding viewBinding = ViewBinding.Cast(GetManifestScript(bindingPath));
+			if (!viewBinding)
+			{
+				Log("Binding manifest for %1 is out of date, %2 not found", m_LayoutRoot.GetName(), bindingPath.Name);
+				return false;
+			}
 
-			viewBinding.SetProperties(GetControllerProperty(viewBinding.Binding_Name), GetControllerProperty(viewBinding.Selected_Item));
+			viewBindings.Insert(viewBinding);
+		}
 
-			// todo find a way to define these on ScriptView aswell
-			// Load RelayCommand
-			if (viewBinding.Relay_Command != string.Empty)
-			{
+		foreach (ViewBinding loadedBinding : viewBindings)
+		{
+			LoadDataBinding(loadedBinding.GetLayoutRoot(), loadedBinding);
+		}
 
-				RelayCommand relayCommand = LoadRelayCommand(viewBinding);
-				// Success! One of the two options were found
-				if (relayCommand)
-				{
-					Log("%2: RelayCommand %1 succesfully acquired. Assigning...", viewBinding.Relay_Command, viewBinding.GetLayoutRoot().GetName());
-					relayCommand.SetController(this);
-					viewBinding.SetRelayCommand(relayCommand);
-				} else // Must be a function on the controller
-				{
-					Log("%2: RelayCommand %1 not found - Assuming its a function on the Controller / ScriptView!", viewBinding.Relay_Command, viewBinding.GetLayoutRoot().GetName());
-				}
+		foreach (ViewPropertyPath controllerPath : manifest.Controllers)
+		{
+			Controller childController = Controller.Cast(GetManifestScript(controllerPath));
+			if (childController && childController != this)
+			{
+				childController.SetParent(this);
 			}
+		}
+
+		binding_count = m_DataBindingHashMap.Count();
+		return true;
+	}
+
+	// Follows the child indices, no search of the widget tree
+	private ScriptedViewBase GetManifestScript(ViewPropertyPath path)
+	{
+		Widget w = path.Resolve(m_LayoutRoot);
+
+		ScriptedViewBase viewBase;
+		if (w)
+		{
+			w.GetScript(viewBase);
+		}
 
-			// Load property for the first time
-			if (viewBinding.Binding_Name != string.Empty)
+		return viewBase;
+	}
+
+	private void LoadDataBinding(Widget w, ViewBinding viewBinding)
+	{
+		viewBinding.SetParent(this);
+		m_ViewBindingHashMap.Insert(w, viewBinding);
+		m_DataBindingHashMap.InsertView(viewBinding);
+
+		viewBinding.SetProperties(GetControllerProperty(viewBinding.Binding_Name), GetControllerProperty(viewBinding.Selected_Item));
+
+		// todo find a way to define these on ScriptView aswell
+		// Load RelayCommand
+		if (viewBinding.Relay_Command != string.Empty)
+		{
+
+			RelayCommand relayCommand = LoadRelayCommand(viewBinding);
+			// Success! One of the two options were found
+			if (relayCommand)
 			{
-				NotifyPropertyChanged(viewBinding.Binding_Name, false);
+				Log("%2: RelayCommand %1 succesfully acquired. Assigning...", viewBinding.Relay_Command, viewBinding.GetLayoutRoot().GetName());
+				relayCommand.SetController(this);
+				viewBinding.SetRelayCommand(relayCommand);
+			} else // Must be a function on the controller
+			{
+				Log("%2: RelayCommand %1 not found - Assuming its a function on the Controller / ScriptView!", viewBinding.Relay_Command, viewBinding.GetLayoutRoot().GetName());
 			}
 		}
 
+		// Load property for the first time
+		if (viewBinding.Binding_Name != string.Empty)
+		{
+			NotifyPropertyChanged(viewBinding.Binding_Name, false);
+		}
+	}
+
+	private int LoadDataBindings(Widget w)
+	{
+		ScriptedViewBase viewBase;
+		w.GetScript(viewBase);
+
+		// If we find a ViewBinding
+		if (viewBase && viewBase.IsInherited(ViewBinding))
+		{
+			LoadDataBinding(w, ViewBinding.Cast(viewBase));
+		}
+
 		// really wish i had XOR here
 		bool b1 = (w.GetChildren() != null);
 		bool b2 = (viewBase && viewBase.IsInherited(Controller) && viewBase != this);
@@ -338,12 +413,30 @@ class Controller : ScriptedViewBase
 		ViewBinding viewBinding = m_ViewBindingHashMap.Get(w);
 		if (viewBinding)
 		{
-			viewBinding.UpdateController(this);
+			viewBinding.RequestUpdateController(this);
+
+			// i.e. enter in an EditBoxWidget
+			if (finished)
+			{
+				viewBinding.FlushController();
+			}
 		}
 
 		return super.OnChange(w, x, y, finished);
 	}
 
+	// Debounced and throttled bindings apply their last value when the widget loses focus
+	override bool OnFocusLost(Widget w, int x, int y)
+	{
+		ViewBinding viewBinding = m_ViewBindingHashMap.Get(w);
+		if (viewBinding)
+		{
+			viewBinding.FlushController();
+		}
+
+		return super.OnFocusLost(w, x, y);
+	}
+
 	// Two way binding interfaces
 	// Specifically for SpacerBaseWidget
 	/*
@@ -0,0 +1,347 @@
+/*
+
+Data templates render collections of plain data objects
+Each item gets a row view of the registered type, views are reused from a pool
+
+Example:
+
+class PlayerRow: DataTemplateView
+{
+	TextWidget Name;
+
+	override string GetLayoutFile()
+	{
+		return "MyMod/gui/layouts/player_row.layout";
+	}
+
+	override void OnDataContextChanged()
+	{
+		PlayerData data = PlayerData.Cast(m_DataContext);
+		if (data)
+			Name.SetText(data.Name);
+	}
+}
+
+modded class LayoutBindingManager
+{
+	override void RegisterDataTemplates(out DataTemplateHashMap data_templates)
+	{
+		super.RegisterDataTemplates(data_templates);
+		data_templates.Insert(PlayerData, PlayerRow);
+	}
+}
+
+	// Bound to a spacer, every PlayerData is shown as a PlayerRow
+	ref ObservableCollection<PlayerData> Players;
+
+*/
+
+// Row view of a data template, the data item is set through SetDataContext
+class DataTemplateView : ScriptView
+{
+	protected Class m_DataContext;
+
+	void SetDataContext(Class data)
+	{
+		m_DataContext = data;
+		OnDataContextChanged();
+	}
+
+	Class GetDataContext()
+	{
+		return m_DataContext;
+	}
+
+	// Abstract, fill the widgets from m_DataContext
+	void OnDataContextChanged();
+}
+
+class DataTemplate : Managed
+{
+	protected typename m_ViewType;
+	protected int m_PoolSize;
+
+	protected ref array<ref DataTemplateView> m_Pool = new array<ref DataTemplateView>();
+
+	void DataTemplate(typename viewType, int poolSize)
+	{
+		m_ViewType = viewType;
+		m_PoolSize = poolSize;
+	}
+
+	typename GetViewType()
+	{
+		return m_ViewType;
+	}
+
+	DataTemplateView Acquire(Class data)
+	{
+		DataTemplateView view;
+		if (m_Pool.Count() > 0)
+		{
+			view = m_Pool[m_Pool.Count() - 1];
+			m_Pool.Remove(m_Pool.Count() - 1);
+			view.GetLayoutRoot().Show(true);
+		} else if (!Class.CastTo(view, m_ViewType.Spawn()))
+		{
+			LayoutBindingManager.Error("DataTemplate: could not create %1", m_ViewType.ToString());
+			return null;
+		}
+
+		view.SetDataContext(data);
+		return view;
+	}
+
+	void Release(DataTemplateView view)
+	{
+		if (!view)
+			return;
+
+		view.SetDataContext(null);
+
+		// Dropped once the pool is full
+		if (m_Pool.Count() >= m_PoolSize || !view.GetLayoutRoot())
+			return;
+
+		Widget root = view.GetLayoutRoot();
+		if (root.GetParent())
+		{
+			root.GetParent().RemoveChild(root);
+		}
+
+		root.Show(false);
+		m_Pool.Insert(view);
+	}
+}
+
+// 0: Data Type
+// 1: Data Template
+class DataTemplateHashMap
+{
+	private autoptr map<typename, ref DataTemplate> value = new map<typename, ref DataTemplate>();
+
+	// Exact type first, then the first registered base type
+	DataTemplate Get(typename dataType)
+	{
+		DataTemplate result = value.Get(dataType);
+
+		if (!result)
+		{
+			foreach (typename type, DataTemplate dataTemplate: value)
+			{
+				if (dataType.IsInherited(type))
+				{
+					return dataTemplate;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	bool Insert(typename dataType, typename viewType, int poolSize = 32)
+	{
+		if (!viewType.IsInherited(DataTemplateView))
+		{
+			LayoutBindingManager.Error(string.Format("DataTemplateHashMap: %1 must inherit from type DataTemplateView", viewType.ToString()));
+			return false;
+		}
+
+		return value.Insert(dataType, new DataTemplate(viewType, poolSize));
+	}
+
+	void Remove(typename dataType)
+	{
+		value.Remove(dataType);
+	}
+}
+
+// Row of a data template collection, holds the item so it outlives removal
+// from the collection until the deferred Remove update released the row
+class DataTemplateEntry : Managed
+{
+	ref Class Data;
+
+	// Null if the item was already gone when the row was added
+	ref DataTemplateView View;
+
+	void DataTemplateEntry(Class data, DataTemplateView view)
+	{
+		Data = data;
+		View = view;
+	}
+}
+
+// Used by Observable for item types with a DataTemplate, one instance per collection
+// Rows are kept in collection order, so the same item added twice gets two rows
+class TypeConversionDataTemplate : TypeConversionTemplate<Class>
+{
+	protected DataTemplate m_DataTemplate;
+
+	protected ref array<ref DataTemplateEntry> m_Rows = new array<ref DataTemplateEntry>();
+
+	// Row the WidgetController works on during a change
+	protected DataTemplateEntry m_Current;
+	protected ref DataTemplateEntry m_Replaced;
+
+	void SetDataTemplate(DataTemplate dataTemplate)
+	{
+		m_DataTemplate = dataTemplate;
+	}
+
+	override Widget GetWidget()
+	{
+		DataTemplateEntry entry = m_Current;
+		if (!entry)
+		{
+			// Outside of a change, i.e. for a selection
+			int index = FindRow(m_Value, 0);
+			if (index != -1)
+				entry = m_Rows[index];
+		}
+
+		if (!entry || !entry.View)
+			return null;
+
+		return entry.View.GetLayoutRoot();
+	}
+
+	override void BeginCollectionChange(CollectionChangedEventArgs args)
+	{
+		m_Current = null;
+
+		int index = args.ChangedIndex;
+		switch (args.ChangedAction)
+		{
+			case NotifyCollectionChangedAction.Insert:
+			{
+				m_Current = CreateRow();
+				m_Rows.Insert(m_Current);
+				break;
+			}
+
+			case NotifyCollectionChangedAction.InsertAt:
+			{
+				m_Current = CreateRow();
+				m_Rows.InsertAt(m_Current, Math.Min(index, m_Rows.Count()));
+				break;
+			}
+
+			case NotifyCollectionChangedAction.Remove:
+			{
+				if (index >= 0 && index < m_Rows.Count())
+					m_Current = m_Rows[index];
+
+				break;
+			}
+
+			case NotifyCollectionChangedAction.Replace:
+			{
+				if (index < 0 || index >= m_Rows.Count())
+					break;
+
+				m_Replaced = m_Rows[index];
+				m_Current = CreateRow();
+				m_Rows[index] = m_Current;
+				break;
+			}
+
+			case NotifyCollectionChangedAction.Move:
+			{
+				// Rows before index are already in place when a CollectionView re-sorts
+				int current = FindRow(m_Value, index);
+				if (current == -1 || index < 0 || index >= m_Rows.Count())
+					break;
+
+				DataTemplateEntry moved = m_Rows[current];
+				m_Rows.RemoveOrdered(current);
+				m_Rows.InsertAt(moved, index);
+				m_Current = moved;
+				break;
+			}
+
+			case NotifyCollectionChangedAction.Swap:
+			{
+				CollectionSwapArgs swap_args = CollectionSwapArgs.Cast(args.ChangedValue);
+				if (swap_args && swap_args.param1 >= 0 && swap_args.param2 >= 0 && swap_args.param1 < m_Rows.Count() && swap_args.param2 < m_Rows.Count())
+					m_Rows.SwapItems(swap_args.param1, swap_args.param2);
+
+				break;
+			}
+		}
+	}
+
+	override void EndCollectionChange(CollectionChangedEventArgs args)
+	{
+		switch (args.ChangedAction)
+		{
+			case NotifyCollectionChangedAction.Remove:
+			{
+				if (m_Current)
+				{
+					m_Rows.RemoveOrdered(args.ChangedIndex);
+					Release(m_Current);
+				}
+
+				break;
+			}
+
+			case NotifyCollectionChangedAction.Replace:
+			{
+				Release(m_Replaced);
+				m_Replaced = null;
+				break;
+			}
+
+			case NotifyCollectionChangedAction.Clear:
+			{
+				foreach (DataTemplateEntry entry: m_Rows)
+				{
+					Release(entry);
+				}
+
+				m_Rows.Clear();
+				break;
+			}
+		}
+
+		m_Current = null;
+	}
+
+	// A row is added even without a view so the row indices stay in step with the collection
+	protected DataTemplateEntry CreateRow()
+	{
+		DataTemplateView view;
+		if (m_Value)
+		{
+			view = m_DataTemplate.Acquire(m_Value);
+		}
+
+		return new DataTemplateEntry(m_Value, view);
+	}
+
+	// First row of the item at or after start, wrapping around, -1 if there is none
+	protected int FindRow(Class data, int start)
+	{
+		if (!data)
+			return -1;
+
+		int count = m_Rows.Count();
+		for (int i = 0; i < count; i++)
+		{
+			int index = (Math.Max(start, 0) + i) % count;
+			if (m_Rows[index].Data == data)
+				return index;
+		}
+
+		return -1;
+	}
+
+	protected void Release(DataTemplateEntry entry)
+	{
+		if (entry && entry.View)
+		{
+			m_DataTemplate.Release(entry.View);
+		}
+	}
+}
@@ -3,6 +3,10 @@ static ref LayoutBindingManager g_LayoutBindingManager;
 class LayoutBindingManager
 {
 	static int LBMLogLevel;
+
+	// Bindings whose widget is not visible in the hierarchy keep their updates until shown
+	// Disable per binding with ViewBinding.Update_When_Hidden
+	static bool DeferHiddenUpdates = true;
 	
 	private static void CheckLayoutBindingManager()
 	{
@@ -30,9 +34,33 @@ class LayoutBindingManager
 		return TypeConverter.Cast(m_TypeConverterHashMap[type].Spawn()); 
 	}
 	
+	static bool HasTypeConversion(typename type)
+	{
+		CheckLayoutBindingManager();
+
+		if (m_TypeConverterHashMap.Get(type))
+			return true;
+
+		return false;
+	}
+
+	protected static ref DataTemplateHashMap m_DataTemplateHashMap;
+	static DataTemplate GetDataTemplate(typename type)
+	{
+		CheckLayoutBindingManager();
+
+		return m_DataTemplateHashMap.Get(type);
+	}
+
 	void LayoutBindingManager()
 	{
 		Log("LayoutBindingManager");
+
+		if (!m_DataTemplateHashMap)
+		{
+			m_DataTemplateHashMap = new DataTemplateHashMap();
+			RegisterDataTemplates(m_DataTemplateHashMap);
+		}
 		
 		if (!m_TypeConverterHashMap)
 		{
@@ -69,6 +97,13 @@ class LayoutBindingManager
 		type_conversions.Insert(ScriptedViewBase, TypeConversionScriptView);
 	}
 	
+	// Override THIS to add your own Data Templates
+	// this determines which ScriptView renders each item of a collection of plain data objects
+	void RegisterDataTemplates(out DataTemplateHashMap data_templates)
+	{
+		Log("LayoutBindingManager::RegisterDataTemplates");
+	}
+
 	// Override THIS to add your own Widget widget_controllers 
 	// this determins how the Widget controls the data sent to it
 	// Great for prefabs
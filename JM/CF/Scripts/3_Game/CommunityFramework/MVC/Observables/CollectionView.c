@@ -0,0 +1,531 @@
+/*
+
+ Filtered and sorted view over an ObservableCollection
+ Changes of the source and of the filter are turned into single Insert, Remove
+ and Move notifications instead of clearing and refilling the bound widgets
+
+Example:
+
+
+class ItemNameFilter: CollectionViewFilter<string>
+{
+	string Search;
+
+	override bool Matches(string value)
+	{
+		return value.Contains(Search);
+	}
+}
+
+class ItemNameComparer: CollectionViewComparer<string>
+{
+	override int Compare(string a, string b)
+	{
+		if (a < b) return -1;
+		if (a > b) return 1;
+		return 0;
+	}
+}
+
+class TraderController: Controller
+{
+	ref ObservableCollection<string> Items;
+
+	// "FilteredItems" goes into Binding_Name
+	ref CollectionView<string> FilteredItems;
+	ref ItemNameFilter Filter = new ItemNameFilter();
+
+	void TraderController()
+	{
+		Items = new ObservableCollection<string>(null);
+		FilteredItems = new CollectionView<string>(Items, this);
+		// Sort first so the filter inserts straight into place
+		FilteredItems.SetComparer(new ItemNameComparer());
+		FilteredItems.SetFilter(Filter);
+	}
+
+	void OnSearchChanged(string search)
+	{
+		Filter.Search = search;
+		FilteredItems.Refresh();
+	}
+}
+
+*/
+
+class CollectionViewFilter<Class TValue>: Managed
+{
+	bool Matches(TValue value)
+	{
+		return true;
+	}
+}
+
+// Negative if a goes before b, positive if after, 0 if equal
+class CollectionViewComparer<Class TValue>: Managed
+{
+	int Compare(TValue a, TValue b)
+	{
+		return 0;
+	}
+}
+
+class CollectionViewListener<Class TValue>: ObservableListener
+{
+	protected CollectionView<TValue> m_View;
+
+	void CollectionViewListener(CollectionView<TValue> view)
+	{
+		m_View = view;
+	}
+
+	override void OnCollectionChanged(CollectionChangedEventArgs args)
+	{
+		m_View.OnSourceChanged(args);
+	}
+}
+
+class CollectionView<Class TValue> : Observable
+{
+	protected ObservableCollection<TValue> m_Source;
+	protected ref CollectionViewListener<TValue> m_Listener;
+
+	protected ref CollectionViewFilter<TValue> m_Filter;
+	protected ref CollectionViewComparer<TValue> m_Comparer;
+
+	// Every source item, in comparer order or source order without a comparer
+	protected ref array<TValue> m_All = {};
+	protected ref array<bool> m_AllVisible = {};
+
+	// Items passing the filter, in the same order as m_All
+	protected ref array<TValue> m_Items = {};
+
+	void CollectionView(ObservableCollection<TValue> source, Controller controller)
+	{
+		m_Type = TemplateType<TValue>.GetType();
+		m_Controller = controller;
+		m_Source = source;
+
+		m_Listener = new CollectionViewListener<TValue>(this);
+		m_Source.AddListener(m_Listener);
+
+		// Existing items are shown by the first Refresh, once the view is assigned to its Controller
+		for (int i = 0; i < m_Source.Count(); i++)
+		{
+			m_All.Insert(m_Source.Get(i));
+			m_AllVisible.Insert(false);
+		}
+	}
+
+	void ~CollectionView()
+	{
+		if (m_Source)
+		{
+			m_Source.RemoveListener(m_Listener);
+		}
+	}
+
+	ObservableCollection<TValue> GetSource()
+	{
+		return m_Source;
+	}
+
+	TValue Get(int index)
+	{
+		return m_Items.Get(index);
+	}
+
+	override int Count()
+	{
+		return m_Items.Count();
+	}
+
+	int Find(TValue value)
+	{
+		return m_Items.Find(value);
+	}
+
+	void SetFilter(CollectionViewFilter<TValue> filter)
+	{
+		m_Filter = filter;
+		Refresh();
+	}
+
+	// Re-runs the filter over every item, call after changing the state of the filter
+	void Refresh()
+	{
+		int visibleIndex = 0;
+		for (int i = 0; i < m_All.Count(); i++)
+		{
+			TValue value = m_All[i];
+			bool wasVisible = m_AllVisible[i];
+			bool isVisible = Matches(value);
+
+			if (wasVisible && isVisible)
+			{
+				visibleIndex++;
+			} else if (wasVisible)
+			{
+				m_AllVisible[i] = false;
+				NotifyRemove(visibleIndex, value);
+				m_Items.Remove(visibleIndex);
+			} else if (isVisible)
+			{
+				m_AllVisible[i] = true;
+				m_Items.InsertAt(value, visibleIndex);
+				NotifyInsert(visibleIndex, value);
+				visibleIndex++;
+			}
+		}
+	}
+
+	// Re-sorts the items, the bound widgets are reordered with Move
+	void SetComparer(CollectionViewComparer<TValue> comparer)
+	{
+		m_Comparer = comparer;
+
+		array<TValue> all = {};
+		array<bool> allVisible = {};
+
+		int i;
+		if (m_Comparer)
+		{
+			array<int> order = {};
+			for (i = 0; i < m_All.Count(); i++)
+			{
+				order.Insert(i);
+			}
+
+			SortIndices(order);
+
+			foreach (int index : order)
+			{
+				all.Insert(m_All[index]);
+				allVisible.Insert(m_AllVisible[index]);
+			}
+		} else
+		{
+			for (i = 0; i < m_Source.Count(); i++)
+			{
+				TValue sourceValue = m_Source.Get(i);
+				all.Insert(sourceValue);
+				allVisible.Insert(Matches(sourceValue));
+			}
+		}
+
+		m_All = all;
+		m_AllVisible = allVisible;
+
+		int visibleIndex = 0;
+		for (i = 0; i < m_All.Count(); i++)
+		{
+			if (!m_AllVisible[i])
+				continue;
+
+			TValue value = m_All[i];
+			if (visibleIndex < m_Items.Count() && m_Items[visibleIndex] == value)
+			{
+				visibleIndex++;
+				continue;
+			}
+
+			int current = -1;
+			for (int j = visibleIndex + 1; j < m_Items.Count(); j++)
+			{
+				if (m_Items[j] == value)
+				{
+					current = j;
+					break;
+				}
+			}
+
+			if (current == -1)
+			{
+				m_Items.InsertAt(value, visibleIndex);
+				NotifyInsert(visibleIndex, value);
+			} else
+			{
+				m_Items.Remove(current);
+				m_Items.InsertAt(value, visibleIndex);
+				NotifyMove(visibleIndex, value);
+			}
+
+			visibleIndex++;
+		}
+
+		// Items that were shown but no longer pass the filter
+		while (m_Items.Count() > visibleIndex)
+		{
+			int last = m_Items.Count() - 1;
+			NotifyRemove(last, m_Items[last]);
+			m_Items.Remove(last);
+		}
+	}
+
+	// [Internal] Called by the source collection
+	void OnSourceChanged(CollectionChangedEventArgs args)
+	{
+		TValue value;
+		Param1<TValue> param = Param1<TValue>.Cast(args.ChangedValue);
+		if (param)
+		{
+			value = param.param1;
+		}
+
+		switch (args.ChangedAction)
+		{
+			case NotifyCollectionChangedAction.Insert:
+			{
+				InsertSourceItem(value, args.ChangedIndex);
+				break;
+			}
+
+			case NotifyCollectionChangedAction.InsertAt:
+			{
+				InsertSourceItem(value, args.ChangedIndex);
+				break;
+			}
+
+			// Sent by the source before the item is removed or replaced
+			case NotifyCollectionChangedAction.Remove:
+			{
+				RemoveSourceItem(value, args.ChangedIndex);
+				break;
+			}
+
+			case NotifyCollectionChangedAction.Replace:
+			{
+				RemoveSourceItem(m_Source.Get(args.ChangedIndex), args.ChangedIndex);
+				InsertSourceItem(value, args.ChangedIndex);
+				break;
+			}
+
+			// Order only matters without a comparer
+			case NotifyCollectionChangedAction.Move:
+			{
+				if (!m_Comparer)
+				{
+					SetComparer(null);
+				}
+
+				break;
+			}
+
+			case NotifyCollectionChangedAction.Swap:
+			{
+				if (!m_Comparer)
+				{
+					SetComparer(null);
+				}
+
+				break;
+			}
+
+			case NotifyCollectionChangedAction.Clear:
+			{
+				m_All.Clear();
+				m_AllVisible.Clear();
+				m_Items.Clear();
+				CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Clear, -1, null));
+				break;
+			}
+		}
+	}
+
+	protected void InsertSourceItem(TValue value, int sourceIndex)
+	{
+		int index = sourceIndex;
+		if (m_Comparer)
+		{
+			index = UpperBound(m_All, value);
+		}
+
+		bool isVisible = Matches(value);
+		m_All.InsertAt(value, index);
+		m_AllVisible.InsertAt(isVisible, index);
+
+		if (!isVisible)
+			return;
+
+		// Appending to the source is the common case, everything visible comes before it
+		int visibleIndex = m_Items.Count();
+		if (index < m_All.Count() - 1)
+		{
+			visibleIndex = GetVisibleIndex(index, value);
+		}
+
+		m_Items.InsertAt(value, visibleIndex);
+		NotifyInsert(visibleIndex, value);
+	}
+
+	protected void RemoveSourceItem(TValue value, int sourceIndex)
+	{
+		int index = sourceIndex;
+		if (m_Comparer)
+		{
+			index = FindSorted(m_All, value);
+		}
+
+		if (index < 0 || index >= m_All.Count())
+			return;
+
+		bool wasVisible = m_AllVisible[index];
+		int visibleIndex;
+		if (wasVisible)
+		{
+			visibleIndex = GetVisibleIndex(index, value);
+		}
+
+		m_All.Remove(index);
+		m_AllVisible.Remove(index);
+
+		if (!wasVisible)
+			return;
+
+		NotifyRemove(visibleIndex, value);
+		m_Items.Remove(visibleIndex);
+	}
+
+	// Index in m_Items of the visible item at index in m_All
+	protected int GetVisibleIndex(int index, TValue value)
+	{
+		// Sorted, so a binary search gives the same position
+		if (m_Comparer)
+		{
+			int sorted = FindSorted(m_Items, value);
+			if (sorted != -1)
+				return sorted;
+
+			return UpperBound(m_Items, value);
+		}
+
+		int visibleIndex = 0;
+		for (int i = 0; i < index; i++)
+		{
+			if (m_AllVisible[i])
+				visibleIndex++;
+		}
+
+		return visibleIndex;
+	}
+
+	protected bool Matches(TValue value)
+	{
+		return !m_Filter || m_Filter.Matches(value);
+	}
+
+	// First index after all items that compare equal to value
+	protected int UpperBound(array<TValue> items, TValue value)
+	{
+		int low = 0;
+		int high = items.Count();
+		while (low < high)
+		{
+			int middle = (low + high) / 2;
+			if (m_Comparer.Compare(items[middle], value) <= 0)
+			{
+				low = middle + 1;
+			} else
+			{
+				high = middle;
+			}
+		}
+
+		return low;
+	}
+
+	// Index of value itself among the items that compare equal to it, -1 if not found
+	protected int FindSorted(array<TValue> items, TValue value)
+	{
+		int low = 0;
+		int high = items.Count();
+		while (low < high)
+		{
+			int middle = (low + high) / 2;
+			if (m_Comparer.Compare(items[middle], value) < 0)
+			{
+				low = middle + 1;
+			} else
+			{
+				high = middle;
+			}
+		}
+
+		for (int i = low; i < items.Count(); i++)
+		{
+			if (items[i] == value)
+				return i;
+
+			if (m_Comparer.Compare(items[i], value) != 0)
+				break;
+		}
+
+		return -1;
+	}
+
+	// Stable merge sort of indices into m_All
+	protected void SortIndices(array<int> order)
+	{
+		int count = order.Count();
+		array<int> buffer = {};
+		buffer.Resize(count);
+
+		for (int width = 1; width < count; width *= 2)
+		{
+			for (int left = 0; left < count; left += width * 2)
+			{
+				int middle = Math.Min(left + width, count);
+				int right = Math.Min(left + width * 2, count);
+
+				int a = left;
+				int b = middle;
+				int k = left;
+				while (a < middle && b < right)
+				{
+					if (m_Comparer.Compare(m_All[order[b]], m_All[order[a]]) < 0)
+					{
+						buffer[k] = order[b];
+						b++;
+					} else
+					{
+						buffer[k] = order[a];
+						a++;
+					}
+
+					k++;
+				}
+
+				while (a < middle)
+				{
+					buffer[k] = order[a];
+					a++;
+					k++;
+				}
+
+				while (b < right)
+				{
+					buffer[k] = order[b];
+					b++;
+					k++;
+				}
+			}
+
+			order.Copy(buffer);
+		}
+	}
+
+	protected void NotifyInsert(int index, TValue value)
+	{
+		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.InsertAt, index, new Param1<TValue>(value)));
+	}
+
+	protected void NotifyRemove(int index, TValue value)
+	{
+		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Remove, index, new Param1<TValue>(value)));
+	}
+
+	protected void NotifyMove(int index, TValue value)
+	{
+		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Move, index, new Param1<TValue>(value)));
+	}
+}
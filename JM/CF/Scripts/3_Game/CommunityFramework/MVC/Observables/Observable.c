@@ -1,4 +1,9 @@
 
+class ObservableListener: Managed
+{
+	void OnCollectionChanged(CollectionChangedEventArgs args);
+}
+
 // Base class for all Observable Types (ObservableCollection, ObservableSet, ObservableDictionary)
 class Observable
 {
@@ -7,6 +12,9 @@ class Observable
 
 	protected Controller m_Controller;
 
+	// Weak, listeners that are deleted are dropped
+	protected ref array<ObservableListener> m_Listeners;
+
 	void Observable(Controller controller)
 	{
 		m_Controller = controller;
@@ -14,7 +22,51 @@ class Observable
 
 	protected void CollectionChanged(CollectionChangedEventArgs args)
 	{
-		m_Controller.NotifyCollectionChanged(args);
+		if (m_Controller)
+		{
+			m_Controller.NotifyCollectionChanged(args);
+		}
+
+		if (!m_Listeners)
+			return;
+
+		for (int i = m_Listeners.Count() - 1; i >= 0; i--)
+		{
+			if (!m_Listeners[i])
+			{
+				m_Listeners.Remove(i);
+			}
+		}
+
+		foreach (ObservableListener listener : m_Listeners)
+		{
+			if (listener)
+			{
+				listener.OnCollectionChanged(args);
+			}
+		}
+	}
+
+	// Listeners are notified after the Controller, see CollectionView
+	void AddListener(ObservableListener listener)
+	{
+		if (!m_Listeners)
+		{
+			m_Listeners = new array<ObservableListener>();
+		}
+
+		if (m_Listeners.Find(listener) == -1)
+		{
+			m_Listeners.Insert(listener);
+		}
+	}
+
+	void RemoveListener(ObservableListener listener)
+	{
+		if (m_Listeners)
+		{
+			m_Listeners.RemoveItem(listener);
+		}
 	}
 
 	typename GetType()
@@ -22,9 +74,26 @@ class Observable
 		return m_Type;
 	}
 
+	// Created once per collection, the value is set before every use
+	protected autoptr TypeConverter m_TypeConverter;
+
 	TypeConverter GetTypeConverter()
 	{
-		return LayoutBindingManager.GetTypeConversion(m_Type);
+		if (!m_TypeConverter)
+		{
+			DataTemplate dataTemplate = LayoutBindingManager.GetDataTemplate(m_Type);
+			if (dataTemplate)
+			{
+				TypeConversionDataTemplate templateConverter = new TypeConversionDataTemplate();
+				templateConverter.SetDataTemplate(dataTemplate);
+				m_TypeConverter = templateConverter;
+			} else
+			{
+				m_TypeConverter = LayoutBindingManager.GetTypeConversion(m_Type);
+			}
+		}
+
+		return m_TypeConverter;
 	}
 
 	// Abstract
@@ -33,7 +33,7 @@ class ScriptView : ScriptedViewBase
 	{
 		m_LayoutRoot = CreateWidget(null);
 
-		LoadViewProperties(this, PropertyTypeHashMap.FromType(Type()), m_LayoutRoot);
+		ViewPropertyCache.Load(this, Type(), GetLayoutFile(), m_LayoutRoot);
 
 		m_LayoutRoot.GetScript(m_Controller);
 
@@ -55,8 +55,10 @@ class ScriptView : ScriptedViewBase
 			}
 
 			// Since its not loaded in the WB, needs to be called here
-			LoadViewProperties(m_Controller, PropertyTypeHashMap.FromType(GetControllerType()), m_LayoutRoot);
+			ViewPropertyCache.Load(m_Controller, GetControllerType(), GetLayoutFile(), m_LayoutRoot);
+			ViewBindingManifest.PushLayout(GetLayoutFile());
 			m_Controller.OnWidgetScriptInit(m_LayoutRoot);
+			ViewBindingManifest.PopLayout();
 		}
 
 		m_Controller.Debug_Logging = Debug_Logging;
@@ -96,8 +98,18 @@ class ScriptView : ScriptedViewBase
 			return result;
 		}
 
+		// Prebuilt by ScriptViewPreloader
+		result = ScriptViewPreloader.Take(GetLayoutFile(), parent);
+		if (result)
+		{
+			Log("Using preloaded %1", GetLayoutFile());
+			return result;
+		}
+
 		Log("Loading %1", GetLayoutFile());
+		ViewBindingManifest.PushLayout(GetLayoutFile());
 		result = workspace.CreateWidgets(GetLayoutFile(), parent);
+		ViewBindingManifest.PopLayout();
 		if (!result)
 		{
 			Error("Invalid layout file %1", GetLayoutFile());
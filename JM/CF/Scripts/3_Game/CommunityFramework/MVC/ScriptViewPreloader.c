@@ -0,0 +1,249 @@
+class ScriptViewReadyCallback: Managed
+{
+	// Widget tree is built, the view has not been created or bound yet
+	void OnWidgetsReady(Widget root);
+
+	// View is constructed and bound to its Controller, keep a reference or it is deleted again
+	void OnViewReady(ScriptView view);
+}
+
+class ScriptViewPreloadJob: Managed
+{
+	string LayoutFile;
+	ref ScriptViewReadyCallback Callback;
+
+	// Only set for CreateAsync
+	bool CreateView;
+	typename ViewType;
+
+	bool WidgetsReady;
+
+	// Root built for this job, the view is expected to take it
+	Widget Root;
+
+	void ScriptViewPreloadJob(string layoutFile, ScriptViewReadyCallback callback)
+	{
+		LayoutFile = layoutFile;
+		Callback = callback;
+	}
+}
+
+/*
+
+Builds layouts ahead of time, one step per frame, so opening a menu does not
+stall on CreateWidgets. Built trees are kept hidden and handed to the next
+ScriptView that loads the same layout.
+
+Example:
+
+	// During loading or while idle
+	ScriptViewPreloader.Preload("MyMod/gui/layouts/trader.layout");
+
+	// Layout is built on one frame, the view is created and bound on the next
+	ScriptViewPreloader.CreateAsync(TraderView, "MyMod/gui/layouts/trader.layout", m_TraderCallback);
+
+*/
+class ScriptViewPreloader
+{
+	// 0: Layout file
+	// 1: Built but unused roots of that layout
+	protected static ref map<string, ref array<Widget>> m_Pool = new map<string, ref array<Widget>>();
+
+	// Original visibility of pooled roots
+	protected static ref map<Widget, bool> m_PoolVisible = new map<Widget, bool>();
+
+	protected static ref array<ref ScriptViewPreloadJob> m_Jobs = new array<ref ScriptViewPreloadJob>();
+	protected static bool m_Running;
+
+	private void ScriptViewPreloader();
+	private void ~ScriptViewPreloader();
+
+	// Queues one more prebuilt copy of the layout
+	static void Preload(string layoutFile, int count = 1)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			AddJob(new ScriptViewPreloadJob(layoutFile, null));
+		}
+	}
+
+	// Creates a view of type over the next frames, the layout file must be the one the view loads
+	static void CreateAsync(typename viewType, string layoutFile, ScriptViewReadyCallback callback = null)
+	{
+		if (!viewType.IsInherited(ScriptView))
+		{
+			LayoutBindingManager.Error("ScriptViewPreloader: %1 must inherit from ScriptView", viewType.ToString());
+			return;
+		}
+
+		ScriptViewPreloadJob job = new ScriptViewPreloadJob(layoutFile, callback);
+		job.CreateView = true;
+		job.ViewType = viewType;
+		AddJob(job);
+	}
+
+	static int GetPendingCount()
+	{
+		return m_Jobs.Count();
+	}
+
+	static int GetPooledCount(string layoutFile)
+	{
+		array<Widget> roots = m_Pool.Get(layoutFile);
+		if (!roots)
+			return 0;
+
+		return roots.Count();
+	}
+
+	// Takes a prebuilt root of the layout, null if none is ready
+	static Widget Take(string layoutFile, Widget parent)
+	{
+		array<Widget> roots = m_Pool.Get(layoutFile);
+		if (!roots || roots.Count() == 0)
+			return null;
+
+		Widget root = roots[roots.Count() - 1];
+		roots.Remove(roots.Count() - 1);
+
+		if (parent)
+		{
+			parent.AddChild(root);
+		}
+
+		root.Show(m_PoolVisible.Get(root));
+		m_PoolVisible.Remove(root);
+
+		return root;
+	}
+
+	// Unlinks every pooled root and drops pending jobs, called when the mission ends
+	static void Clear()
+	{
+		foreach (string layoutFile, array<Widget> roots : m_Pool)
+		{
+			foreach (Widget root : roots)
+			{
+				if (root)
+				{
+					root.Unlink();
+				}
+			}
+		}
+
+		m_Pool.Clear();
+		m_PoolVisible.Clear();
+		m_Jobs.Clear();
+
+		Stop();
+	}
+
+	protected static void AddJob(ScriptViewPreloadJob job)
+	{
+		m_Jobs.Insert(job);
+
+		if (!m_Running && GetGame())
+		{
+			m_Running = true;
+			GetGame().GetCallQueue(CALL_CATEGORY_GUI).CallLater(OnFrame, 0, true);
+		}
+	}
+
+	protected static void Stop()
+	{
+		if (!m_Running)
+			return;
+
+		m_Running = false;
+		if (GetGame())
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(OnFrame);
+		}
+	}
+
+	// One step per frame, either building a layout or creating a view
+	protected static void OnFrame()
+	{
+		if (m_Jobs.Count() == 0)
+		{
+			Stop();
+			return;
+		}
+
+		ScriptViewPreloadJob job = m_Jobs[0];
+
+		if (!job.WidgetsReady)
+		{
+			Widget root = Build(job.LayoutFile);
+			job.WidgetsReady = true;
+			job.Root = root;
+
+			if (job.Callback && root)
+			{
+				job.Callback.OnWidgetsReady(root);
+			}
+
+			// Plain preloads are done here, views are created on the next frame
+			if (job.CreateView)
+				return;
+		} else
+		{
+			ScriptView view = ScriptView.Cast(job.ViewType.Spawn());
+
+			// The view loaded a different layout, so it built its own tree synchronously
+			if (job.Root && (!view || view.GetLayoutRoot() != job.Root))
+			{
+				LayoutBindingManager.Error("ScriptViewPreloader: %1 does not load %2, pass the layout file it returns from GetLayoutFile", job.ViewType.ToString(), job.LayoutFile);
+				Discard(job.LayoutFile, job.Root);
+			}
+
+			if (job.Callback)
+			{
+				job.Callback.OnViewReady(view);
+			}
+		}
+
+		m_Jobs.RemoveOrdered(0);
+	}
+
+	// Removes an unused root from the pool
+	protected static void Discard(string layoutFile, Widget root)
+	{
+		array<Widget> roots = m_Pool.Get(layoutFile);
+		if (!roots || roots.Find(root) == -1)
+			return;
+
+		roots.RemoveItem(root);
+		m_PoolVisible.Remove(root);
+		root.Unlink();
+	}
+
+	protected static Widget Build(string layoutFile)
+	{
+		WorkspaceWidget workspace = GetGame().GetWorkspace();
+		if (!workspace)
+			return null;
+
+		ViewBindingManifest.PushLayout(layoutFile);
+		Widget root = workspace.CreateWidgets(layoutFile);
+		ViewBindingManifest.PopLayout();
+		if (!root)
+		{
+			LayoutBindingManager.Error("ScriptViewPreloader: invalid layout file %1", layoutFile);
+			return null;
+		}
+
+		m_PoolVisible.Insert(root, root.IsVisible());
+		root.Show(false);
+
+		array<Widget> roots = m_Pool.Get(layoutFile);
+		if (!roots)
+		{
+			roots = new array<Widget>();
+			m_Pool.Insert(layoutFile, roots);
+		}
+
+		roots.Insert(root);
+		return root;
+	}
+}
@@ -22,11 +22,23 @@ class ScriptedViewBase : Managed
 		return m_WidgetController;
 	}
 
-	// ScriptedViewBase Type Converter
+	// ScriptedViewBase Type Converter, created on first use
 	[NonSerialized()]
 	protected autoptr TypeConverter m_TypeConverter;
 	TypeConverter GetTypeConversion()
 	{
+		if (!m_TypeConverter)
+		{
+			m_TypeConverter = LayoutBindingManager.GetTypeConversion(Type());
+			if (!m_TypeConverter)
+			{
+				Error("Could not generate TypeConverter on %1", Type().ToString());
+				return null;
+			}
+
+			m_TypeConverter.Set(this);
+		}
+
 		return m_TypeConverter;
 	}
 
@@ -38,13 +50,20 @@ class ScriptedViewBase : Managed
 		return m_ParentScriptedViewBase;
 	}
 
+	// Only created once the view is attached to a layout root
 	[NonSerialized()]
 	protected autoptr ScriptedViewBaseHandler m_ScriptedViewBaseHandler;
 	ScriptedViewBaseHandler GetHandler()
 	{
+		if (UseSharedHandler())
+			return ScriptedViewBaseHandler.GetShared();
+
 		return m_ScriptedViewBaseHandler;
 	}
 
+	[NonSerialized()]
+	protected Widget m_SharedHandlerRoot;
+
 	void SetParent(ScriptedViewBase parent)
 	{
 		m_ParentScriptedViewBase = parent;
@@ -57,29 +76,42 @@ class ScriptedViewBase : Managed
 	{
 		if (Debug_Logging)
 			PrintFormat("[Log] %1", this);
-
-		m_TypeConverter = LayoutBindingManager.GetTypeConversion(Type());
-		if (!m_TypeConverter)
-		{
-			Error("Could not generate TypeConverter on %1", Type().ToString());
-			return;
-		}
-
-		m_ScriptedViewBaseHandler = new ScriptedViewBaseHandler(this);
-		m_TypeConverter.Set(this);
 	}
 
 	void ~ScriptedViewBase()
 	{
 		if (Debug_Logging)
 			PrintFormat("[Log] ~%1", this);
+
+		if (m_SharedHandlerRoot)
+			ScriptedViewBaseHandler.UnregisterShared(m_SharedHandlerRoot);
+	}
+
+	// Override and return true to route the events of this view through one
+	// handler shared by all views instead of allocating one per instance.
+	// Meant for high count leaf views such as list rows or map markers,
+	// a view nested inside another shared view receives the events first
+	bool UseSharedHandler()
+	{
+		return false;
 	}
 
 	void OnWidgetScriptInit(Widget w)
 	{
 		Trace("OnWidgetScriptInit %1", w.ToString());
 		m_LayoutRoot = w;
-		m_LayoutRoot.SetHandler(m_ScriptedViewBaseHandler);
+
+		if (UseSharedHandler())
+		{
+			m_SharedHandlerRoot = m_LayoutRoot;
+			ScriptedViewBaseHandler.RegisterShared(m_LayoutRoot, this);
+		} else
+		{
+			if (!m_ScriptedViewBaseHandler)
+				m_ScriptedViewBaseHandler = new ScriptedViewBaseHandler(this);
+
+			m_LayoutRoot.SetHandler(m_ScriptedViewBaseHandler);
+		}
 
 		m_WidgetController = LayoutBindingManager.GetWidgetController(m_LayoutRoot);
 		if (!m_WidgetController)
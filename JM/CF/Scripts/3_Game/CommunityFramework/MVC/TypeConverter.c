@@ -38,6 +38,10 @@ class TypeConverter
 	void SetToController(Class context, string name, int index);
 	void GetFromController(Class context, string name, int index);
 
+	// Called by collection bindings before and after the WidgetController applies a change
+	void BeginCollectionChange(CollectionChangedEventArgs args);
+	void EndCollectionChange(CollectionChangedEventArgs args);
+
 	static func GetterFromType(typename type)
 	{
 		switch (type)
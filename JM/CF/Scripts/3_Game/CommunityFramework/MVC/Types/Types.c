@@ -15,7 +15,7 @@ class PropertyInfo
 		if (!context)
 			return null;
 
-		PropertyTypeHashMap hash_map = PropertyTypeHashMap.FromType(context.Type());
+		PropertyTypeHashMap hash_map = PropertyTypeHashMap.GetCached(context.Type());
 		if (hash_map[name])
 		{
 			return new PropertyInfo(name, hash_map[name]);
@@ -26,7 +26,7 @@ class PropertyInfo
 	
 	static PropertyInfo GetFromType(typename parent_type, string name)
 	{
-		PropertyTypeHashMap hash_map = PropertyTypeHashMap.FromType(parent_type);
+		PropertyTypeHashMap hash_map = PropertyTypeHashMap.GetCached(parent_type);
 		if (hash_map[name])
 		{
 			return new PropertyInfo(name, hash_map[name]);
@@ -52,6 +52,21 @@ class PropertyTypeHashMap: map<string, typename>
 		return hash_map;
 	}
 	
+	protected static ref map<typename, ref PropertyTypeHashMap> s_Cache = new map<typename, ref PropertyTypeHashMap>();
+	
+	// Shared per type, do not modify the result. Use FromType for a private copy
+	static PropertyTypeHashMap GetCached(typename type)
+	{
+		PropertyTypeHashMap hash_map = s_Cache.Get(type);
+		if (!hash_map)
+		{
+			hash_map = FromType(type);
+			s_Cache.Insert(type, hash_map);
+		}
+		
+		return hash_map;
+	}
+	
 	void RemoveType(typename removed_type)
 	{
 		PropertyTypeHashMap hash_map = FromType(removed_type);
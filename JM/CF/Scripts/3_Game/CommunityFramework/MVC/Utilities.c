@@ -45,6 +45,150 @@ static void LoadViewProperties(Class context, PropertyTypeHashMap property_map,
 	}
 }
 
+// Widget property of a view and where its widget is in the layout
+class ViewPropertyPath: Managed
+{
+	string Name;
+
+	// Child index at each level below the root, empty for the root itself
+	ref array<int> Path = {};
+
+	// Without a widget the path is filled by the caller, i.e. from a ViewBindingManifest
+	void ViewPropertyPath(string name, Widget root_widget = null, Widget widget = null)
+	{
+		Name = name;
+
+		while (widget && widget != root_widget)
+		{
+			int index = 0;
+			Widget sibling = widget.GetParent().GetChildren();
+			while (sibling != widget)
+			{
+				sibling = sibling.GetSibling();
+				index++;
+			}
+
+			Path.InsertAt(index, 0);
+			widget = widget.GetParent();
+		}
+	}
+
+	// Indices separated by commas, "-" for the root
+	string FormatPath()
+	{
+		if (Path.Count() == 0)
+			return "-";
+
+		string result = Path[0].ToString();
+		for (int i = 1; i < Path.Count(); i++)
+		{
+			result += "," + Path[i].ToString();
+		}
+
+		return result;
+	}
+
+	void ParsePath(string path)
+	{
+		Path.Clear();
+		if (path == "-")
+			return;
+
+		TStringArray indices = {};
+		path.Split(",", indices);
+		foreach (string index : indices)
+		{
+			Path.Insert(index.ToInt());
+		}
+	}
+
+	// Null if the layout no longer has the widget at the recorded place
+	Widget Resolve(Widget root_widget)
+	{
+		Widget widget = root_widget;
+		foreach (int index : Path)
+		{
+			widget = widget.GetChildren();
+			while (widget && index > 0)
+			{
+				widget = widget.GetSibling();
+				index--;
+			}
+
+			if (!widget)
+				return null;
+		}
+
+		if (widget.GetName() != Name)
+			return null;
+
+		return widget;
+	}
+}
+
+// Same as LoadViewProperties but for views created many times from one layout
+// The first load records where each property's widget is in the layout, later
+// loads of the same type and layout follow those child indices instead of
+// searching the whole tree with FindAnyWidget for every property
+class ViewPropertyCache
+{
+	// 0: Type name + layout file
+	// 1: Resolved properties
+	protected static ref map<string, ref array<ref ViewPropertyPath>> m_PropertyCache = new map<string, ref array<ref ViewPropertyPath>>();
+
+	static void Load(Class context, typename type, string layout_file, Widget root_widget)
+	{
+		string key = type.ToString() + ":" + layout_file;
+
+		array<ref ViewPropertyPath> properties = m_PropertyCache.Get(key);
+		if (!properties)
+		{
+			properties = {};
+			foreach (string propertyName, typename property_type : PropertyTypeHashMap.GetCached(type))
+			{
+				if (!property_type.IsInherited(Widget))
+					continue;
+
+				// Same rules as LoadViewProperties, the root only when nothing below has the name
+				Widget found = root_widget.FindAnyWidget(propertyName);
+				if (root_widget.GetName() == propertyName)
+				{
+					if (found)
+						continue;
+
+					found = root_widget;
+				}
+
+				if (found)
+				{
+					properties.Insert(new ViewPropertyPath(propertyName, root_widget, found));
+				}
+			}
+
+			m_PropertyCache.Insert(key, properties);
+		}
+
+		foreach (ViewPropertyPath property : properties)
+		{
+			Widget target = property.Resolve(root_widget);
+			if (!target)
+			{
+				target = root_widget.FindAnyWidget(property.Name);
+			}
+
+			if (target)
+			{
+				EnScript.SetClassVar(context, property.Name, 0, target);
+			}
+		}
+	}
+
+	static void Clear()
+	{
+		m_PropertyCache.Clear();
+	}
+}
+
 // 0: Context of Start Scope, out is context of final scope
 // 1: Name of variable string Ex: m_Binding.Value.Root
 // return: Final variable name
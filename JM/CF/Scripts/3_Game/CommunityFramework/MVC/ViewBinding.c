@@ -12,6 +12,22 @@ class ViewBinding : ScriptedViewBase
 	// Type of RelayCommand class that is controlled by ViewBinding
 	reference string Relay_Command;
 
+	// Milliseconds without changes before the controller is updated, 0 to update on every change
+	reference int Debounce_Time;
+
+	// Minimum milliseconds between two controller updates, 0 for no limit
+	reference int Throttle_Time;
+
+	// Keep updating the widget while it is hidden, see LayoutBindingManager.DeferHiddenUpdates
+	reference bool Update_When_Hidden;
+
+	// Updates received while hidden, in order
+	protected ref array<ref ViewUpdateEntry> m_HiddenUpdates;
+
+	// Waiting for Debounce_Time or Throttle_Time
+	protected Controller m_PendingController;
+	protected int m_LastControllerUpdate = -1;
+
 	// Strong reference to Relay Command
 	protected autoptr RelayCommand m_RelayCommand;
 	void SetRelayCommand(RelayCommand relayCommand)
@@ -89,6 +105,7 @@ class ViewBinding : ScriptedViewBase
 			Log("Updating %1 to the value of %2", m_LayoutRoot.GetName(), Binding_Name);
 			m_PropertyConverter.GetFromController(controller, Binding_Name, 0);
 			m_WidgetController.Set(m_PropertyConverter);
+			ViewUpdateQueue.OnWidgetWrite(controller);
 		}
 
 		// Selected_Item handler
@@ -97,7 +114,118 @@ class ViewBinding : ScriptedViewBase
 			Log("Updating %1 to the value of %2", m_LayoutRoot.GetName(), Selected_Item);
 			m_SelectedConverter.GetFromController(controller, Selected_Item, 0);
 			m_WidgetController.SetSelection(m_SelectedConverter);
+			ViewUpdateQueue.OnWidgetWrite(controller);
+		}
+	}
+
+	void ~ViewBinding()
+	{
+		if (m_PendingController && GetGame())
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(FlushController);
+		}
+	}
+
+	bool IsHiddenInHierarchy()
+	{
+		return !Update_When_Hidden && m_LayoutRoot && !m_LayoutRoot.IsVisibleHierarchy();
+	}
+
+	// Returns true for the first update held back since the widget was hidden
+	bool AddHiddenUpdate(ViewUpdateEntry entry)
+	{
+		bool first = !m_HiddenUpdates;
+		if (first)
+		{
+			m_HiddenUpdates = new array<ref ViewUpdateEntry>();
+		}
+
+		if (entry.Args)
+		{
+			// Collection changes before a clear are irrelevant
+			if (entry.Args.ChangedAction == NotifyCollectionChangedAction.Clear)
+			{
+				for (int i = m_HiddenUpdates.Count() - 1; i >= 0; i--)
+				{
+					if (m_HiddenUpdates[i].Args)
+					{
+						m_HiddenUpdates.RemoveOrdered(i);
+					}
+				}
+			}
+		} else
+		{
+			// The value is read when applied, one property update is enough
+			foreach (ViewUpdateEntry hidden : m_HiddenUpdates)
+			{
+				if (!hidden.Args && hidden.Context == entry.Context)
+					return first;
+			}
+		}
+
+		m_HiddenUpdates.Insert(entry);
+		return first;
+	}
+
+	array<ref ViewUpdateEntry> TakeHiddenUpdates()
+	{
+		array<ref ViewUpdateEntry> updates = m_HiddenUpdates;
+		m_HiddenUpdates = null;
+
+		if (!updates)
+		{
+			updates = new array<ref ViewUpdateEntry>();
+		}
+
+		return updates;
+	}
+
+	// View -> Controller, honoring Debounce_Time and Throttle_Time
+	void RequestUpdateController(Controller controller)
+	{
+		if (Debounce_Time <= 0 && Throttle_Time <= 0)
+		{
+			UpdateController(controller);
+			return;
+		}
+
+		ScriptCallQueue queue = GetGame().GetCallQueue(CALL_CATEGORY_GUI);
+
+		if (Debounce_Time > 0)
+		{
+			// Restart the wait on every change
+			queue.Remove(FlushController);
+			m_PendingController = controller;
+			queue.CallLater(FlushController, Debounce_Time);
+			return;
+		}
+
+		if (m_PendingController)
+			return;
+
+		int elapsed = GetGame().GetTime() - m_LastControllerUpdate;
+		if (m_LastControllerUpdate == -1 || elapsed >= Throttle_Time)
+		{
+			UpdateController(controller);
+			return;
 		}
+
+		// Trailing update so the last value is never lost
+		m_PendingController = controller;
+		queue.CallLater(FlushController, Throttle_Time - elapsed);
+	}
+
+	// Applies a pending debounced or throttled update immediately, i.e. when focus is lost
+	void FlushController()
+	{
+		if (!m_PendingController)
+			return;
+
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(FlushController);
+
+		Controller controller = m_PendingController;
+		m_PendingController = null;
+		UpdateController(controller);
 	}
 
 	// View -> Controller
@@ -107,6 +235,8 @@ class ViewBinding : ScriptedViewBase
 		if (!m_WidgetController)
 			return;
 
+		m_LastControllerUpdate = GetGame().GetTime();
+
 		// Binding_Name handler
 		if (m_PropertyConverter && Two_Way_Binding && m_WidgetController.CanTwoWayBind())
 		{
@@ -150,6 +280,8 @@ class ViewBinding : ScriptedViewBase
 			collectionConverter.SetParam(args.ChangedValue);
 		}
 
+		collectionConverter.BeginCollectionChange(args);
+
 		switch (args.ChangedAction)
 		{
 			case NotifyCollectionChangedAction.Insert:
@@ -198,8 +330,13 @@ class ViewBinding : ScriptedViewBase
 			default:
 			{
 				Error("Invalid NotifyCollectionChangedAction Type %1", args.ChangedAction.ToString());
+				return;
 			}
 		}
+
+		collectionConverter.EndCollectionChange(args);
+
+		ViewUpdateQueue.OnWidgetWrite(Controller.Cast(m_ParentScriptedViewBase));
 	}
 
 	// View -> Collection
@@ -0,0 +1,247 @@
+// ViewBindings and child Controllers of one Controller in a layout
+class ViewBindingManifestScope: Managed
+{
+	string ControllerType;
+	string RootName;
+
+	// Widget names, unique within the Controller, and their child indices below the Controller root
+	ref array<ref ViewPropertyPath> Bindings = {};
+	ref array<ref ViewPropertyPath> Controllers = {};
+
+	void ViewBindingManifestScope(string controllerType, string rootName)
+	{
+		ControllerType = controllerType;
+		RootName = rootName;
+	}
+
+	string GetKey()
+	{
+		return ControllerType + ":" + RootName;
+	}
+}
+
+/*
+
+Precomputed ViewBinding locations, written next to each layout by the
+"Validate MVC Bindings" Workbench plugin as <layout>.bindings
+
+Controllers created from a layout with a manifest follow the recorded child
+indices to their bindings instead of walking the widget tree. Layouts without one, or with a
+manifest that no longer matches, are walked as before.
+
+The first line is the length and line hash of the layout the manifest was
+written for. A layout edited after the plugin ran no longer matches and the
+manifest is ignored, so a renamed or moved widget can't drop its bindings.
+
+File format, one scope per Controller:
+
+	layout <length> <hash>
+	controller <Controller type> <root widget name>
+	binding <widget name> <child indices below the root, comma separated>
+	child <widget name> <child indices below the root, comma separated>
+
+*/
+class ViewBindingManifest
+{
+	static const string EXTENSION = ".bindings";
+
+	// 0: Layout file
+	// 1: Scopes by ViewBindingManifestScope.GetKey, null if the layout has no manifest
+	protected static ref map<string, ref map<string, ref ViewBindingManifestScope>> m_Manifests = new map<string, ref map<string, ref ViewBindingManifestScope>>();
+
+	// Layouts currently being created, Controllers created by the engine can't see their layout file
+	protected static ref TStringArray m_LayoutStack = {};
+
+	private void ViewBindingManifest();
+	private void ~ViewBindingManifest();
+
+	static void PushLayout(string layoutFile)
+	{
+		m_LayoutStack.Insert(layoutFile);
+	}
+
+	static void PopLayout()
+	{
+		if (m_LayoutStack.Count() > 0)
+		{
+			m_LayoutStack.Remove(m_LayoutStack.Count() - 1);
+		}
+	}
+
+	static string GetCurrentLayout()
+	{
+		if (m_LayoutStack.Count() == 0)
+			return string.Empty;
+
+		return m_LayoutStack[m_LayoutStack.Count() - 1];
+	}
+
+	static ViewBindingManifestScope Find(string layoutFile, typename controllerType, string rootName)
+	{
+		if (layoutFile == string.Empty)
+			return null;
+
+		map<string, ref ViewBindingManifestScope> scopes;
+		if (!m_Manifests.Find(layoutFile, scopes))
+		{
+			scopes = Read(layoutFile);
+			m_Manifests.Insert(layoutFile, scopes);
+		}
+
+		if (!scopes)
+			return null;
+
+		return scopes.Get(controllerType.ToString() + ":" + rootName);
+	}
+
+	// Forget loaded manifests, i.e. after they were regenerated
+	static void Clear()
+	{
+		m_Manifests.Clear();
+	}
+
+	// Length and line hash of the layout, there is no API for the size or modification time of a file
+	static string GetFingerprint(string layoutFile)
+	{
+		FileHandle handle = OpenFile(layoutFile, FileMode.READ);
+		if (handle == 0)
+			return string.Empty;
+
+		int length = 0;
+		int hash = 0;
+
+		string line;
+		while (FGets(handle, line) >= 0)
+		{
+			length += line.Length() + 1;
+			hash = hash * 31 + line.Hash();
+		}
+
+		CloseFile(handle);
+		return length.ToString() + " " + hash.ToString();
+	}
+
+	// Null if there is no manifest or it was written for a different version of the layout
+	static map<string, ref ViewBindingManifestScope> Read(string layoutFile)
+	{
+		string path = layoutFile + EXTENSION;
+		if (!FileExist(path))
+			return null;
+
+		FileHandle handle = OpenFile(path, FileMode.READ);
+		if (handle == 0)
+			return null;
+
+		map<string, ref ViewBindingManifestScope> scopes = new map<string, ref ViewBindingManifestScope>();
+		ViewBindingManifestScope scope;
+
+		string line;
+		if (FGets(handle, line) < 0 || line.Trim() != "layout " + GetFingerprint(layoutFile))
+		{
+			LayoutBindingManager.Log("Binding manifest for %1 is out of date, run Validate MVC Bindings again", layoutFile);
+			CloseFile(handle);
+			return null;
+		}
+
+		while (FGets(handle, line) >= 0)
+		{
+			line = line.Trim();
+
+			TStringArray tokens = {};
+			line.Split(" ", tokens);
+			if (tokens.Count() < 2)
+				continue;
+
+			switch (tokens[0])
+			{
+				case "controller":
+				{
+					if (tokens.Count() < 3)
+						break;
+
+					scope = new ViewBindingManifestScope(tokens[1], tokens[2]);
+					scopes.Insert(scope.GetKey(), scope);
+					break;
+				}
+
+				case "binding":
+				{
+					// Written before child indices were recorded
+					if (tokens.Count() < 3)
+					{
+						scopes = null;
+						break;
+					}
+
+					if (scope)
+						scope.Bindings.Insert(ReadEntry(tokens[1], tokens[2]));
+
+					break;
+				}
+
+				case "child":
+				{
+					// Written before child indices were recorded
+					if (tokens.Count() < 3)
+					{
+						scopes = null;
+						break;
+					}
+
+					if (scope)
+						scope.Controllers.Insert(ReadEntry(tokens[1], tokens[2]));
+
+					break;
+				}
+			}
+
+			if (!scopes)
+			{
+				LayoutBindingManager.Log("Binding manifest for %1 is out of date, run Validate MVC Bindings again", layoutFile);
+				break;
+			}
+		}
+
+		CloseFile(handle);
+		return scopes;
+	}
+
+	protected static ViewPropertyPath ReadEntry(string name, string path)
+	{
+		ViewPropertyPath entry = new ViewPropertyPath(name);
+		entry.ParsePath(path);
+		return entry;
+	}
+
+	// layoutFile is read for the fingerprint, the manifest is written next to it
+	static bool Write(string layoutFile, array<ref ViewBindingManifestScope> scopes)
+	{
+		string fingerprint = GetFingerprint(layoutFile);
+		if (fingerprint == string.Empty)
+			return false;
+
+		FileHandle handle = OpenFile(layoutFile + EXTENSION, FileMode.WRITE);
+		if (handle == 0)
+			return false;
+
+		FPrintln(handle, "layout " + fingerprint);
+
+		foreach (ViewBindingManifestScope scope : scopes)
+		{
+			FPrintln(handle, "controller " + scope.ControllerType + " " + scope.RootName);
+
+			foreach (ViewPropertyPath binding : scope.Bindings)
+			{
+				FPrintln(handle, "binding " + binding.Name + " " + binding.FormatPath());
+			}
+
+			foreach (ViewPropertyPath controller : scope.Controllers)
+			{
+				FPrintln(handle, "child " + controller.Name + " " + controller.FormatPath());
+			}
+		}
+
+		CloseFile(handle);
+		return true;
+	}
+}
@@ -0,0 +1,389 @@
+// Update counts and time of one frame, either for all of MVC or a single Controller
+class ViewUpdateStats: Managed
+{
+	int PropertyUpdates;
+	int CollectionUpdates;
+	int WidgetWrites;
+
+	// Updates that were moved to a later frame because the budget ran out
+	int Deferred;
+
+	// TickCount ticks spent in UpdateView and UpdateViewFromCollection
+	int Ticks;
+
+	float GetMilliseconds()
+	{
+		return Ticks / ViewUpdateQueue.TICKS_PER_MS;
+	}
+
+	string ToStringStats()
+	{
+		return string.Format("props=%1 collections=%2 writes=%3 deferred=%4 ms=%5", PropertyUpdates, CollectionUpdates, WidgetWrites, Deferred, GetMilliseconds());
+	}
+}
+
+class ViewUpdateEntry: Managed
+{
+	ViewBinding View;
+	Controller Context;
+
+	// Only set for collection updates, kept alive until the update ran
+	ref CollectionChangedEventArgs Args;
+	ref Param ChangedValue;
+
+	void ViewUpdateEntry(ViewBinding view, Controller context, CollectionChangedEventArgs args)
+	{
+		View = view;
+		Context = context;
+		Args = args;
+
+		if (Args)
+		{
+			ChangedValue = Args.ChangedValue;
+		}
+	}
+}
+
+/*
+
+Routes all Controller -> View updates, counts and times them per frame and
+optionally spreads them over several frames.
+
+Stats are only collected while enabled, the budget is off by default.
+Once the budget of a frame is used up every following update, including
+those of later frames, goes to the back of one FIFO queue so the order of
+updates on a binding is kept.
+
+Example:
+
+	ViewUpdateQueue.SetStatsEnabled(true);
+	ViewUpdateQueue.SetBudget(2.0);
+	ViewUpdateQueue.ShowOverlay(true);
+	...
+	PrintFormat("%1", ViewUpdateQueue.GetLastFrame().ToStringStats());
+
+*/
+class ViewUpdateQueue
+{
+	static const float TICKS_PER_MS = 10000.0;
+
+	protected static bool m_StatsEnabled;
+
+	// 0 disables the budget
+	protected static int m_BudgetTicks;
+
+	protected static int m_FrameTicks;
+
+	protected static ref ViewUpdateStats m_Frame = new ViewUpdateStats();
+	protected static ref ViewUpdateStats m_LastFrame = new ViewUpdateStats();
+
+	protected static ref map<Controller, ref ViewUpdateStats> m_ControllerStats = new map<Controller, ref ViewUpdateStats>();
+	protected static ref map<Controller, ref ViewUpdateStats> m_LastControllerStats = new map<Controller, ref ViewUpdateStats>();
+
+	protected static ref array<ref ViewUpdateEntry> m_Queue = new array<ref ViewUpdateEntry>();
+	protected static int m_QueueIndex;
+
+	protected static TextWidget m_Overlay;
+
+	// Weak, bindings holding updates until their widget is visible again
+	protected static ref array<ViewBinding> m_HiddenViews = new array<ViewBinding>();
+
+	private void ViewUpdateQueue();
+	private void ~ViewUpdateQueue();
+
+	static void SetStatsEnabled(bool enabled)
+	{
+		m_StatsEnabled = enabled;
+	}
+
+	static bool IsStatsEnabled()
+	{
+		return m_StatsEnabled;
+	}
+
+	// Maximum time per frame spent updating views, 0 to disable
+	static void SetBudget(float milliseconds)
+	{
+		m_BudgetTicks = Math.Max(milliseconds, 0) * TICKS_PER_MS;
+	}
+
+	static float GetBudget()
+	{
+		return m_BudgetTicks / TICKS_PER_MS;
+	}
+
+	static int GetPendingCount()
+	{
+		return m_Queue.Count() - m_QueueIndex;
+	}
+
+	// Bindings with updates held back because they are hidden, see LayoutBindingManager.DeferHiddenUpdates
+	static int GetHiddenCount()
+	{
+		return m_HiddenViews.Count();
+	}
+
+	static ViewUpdateStats GetLastFrame()
+	{
+		return m_LastFrame;
+	}
+
+	// Stats of the last frame for a single Controller, null if it had no updates
+	static ViewUpdateStats GetLastFrame(Controller controller)
+	{
+		return m_LastControllerStats.Get(controller);
+	}
+
+	static map<Controller, ref ViewUpdateStats> GetLastFrameControllers()
+	{
+		return m_LastControllerStats;
+	}
+
+	// Shows the stats of the last frame in the top left corner
+	static void ShowOverlay(bool show)
+	{
+		if (!show)
+		{
+			if (m_Overlay)
+			{
+				m_Overlay.Unlink();
+			}
+
+			m_Overlay = null;
+			return;
+		}
+
+		if (m_Overlay || !GetGame() || !GetGame().GetWorkspace())
+			return;
+
+		m_Overlay = TextWidget.Cast(GetGame().GetWorkspace().CreateWidget(TextWidgetTypeID, 10, 10, 600, 200, WidgetFlags.VISIBLE | WidgetFlags.IGNOREPOINTER, ARGB(255, 255, 255, 255), 1000, null));
+	}
+
+	// Controller -> view
+	static void UpdateView(ViewBinding view, Controller controller)
+	{
+		if (!ShouldRun())
+		{
+			Defer(new ViewUpdateEntry(view, controller, null));
+			return;
+		}
+
+		Run(view, controller, null);
+	}
+
+	// Collection -> view
+	static void UpdateViewFromCollection(ViewBinding view, Controller controller, CollectionChangedEventArgs args)
+	{
+		if (!ShouldRun())
+		{
+			Defer(new ViewUpdateEntry(view, controller, args));
+			return;
+		}
+
+		Run(view, controller, args);
+	}
+
+	// Called by ViewBinding for every value written to a WidgetController
+	static void OnWidgetWrite(Controller controller)
+	{
+		if (!m_StatsEnabled)
+			return;
+
+		m_Frame.WidgetWrites++;
+
+		if (controller)
+		{
+			GetControllerStats(controller).WidgetWrites++;
+		}
+	}
+
+	// [Internal] Called once per frame from DayZGame.OnUpdate
+	static void _OnFrame()
+	{
+		ViewUpdateStats lastFrame = m_LastFrame;
+		m_LastFrame = m_Frame;
+		m_Frame = lastFrame;
+		m_Frame.PropertyUpdates = 0;
+		m_Frame.CollectionUpdates = 0;
+		m_Frame.WidgetWrites = 0;
+		m_Frame.Deferred = 0;
+		m_Frame.Ticks = 0;
+
+		map<Controller, ref ViewUpdateStats> lastControllers = m_LastControllerStats;
+		m_LastControllerStats = m_ControllerStats;
+		m_ControllerStats = lastControllers;
+		m_ControllerStats.Clear();
+
+		m_FrameTicks = 0;
+
+		if (m_Overlay)
+		{
+			UpdateOverlay();
+		}
+
+		FlushVisible();
+
+		// Rolled over updates go first, new ones queue behind them until it is empty
+		while (m_QueueIndex < m_Queue.Count() && (m_BudgetTicks <= 0 || m_FrameTicks < m_BudgetTicks))
+		{
+			ViewUpdateEntry entry = m_Queue[m_QueueIndex];
+			m_QueueIndex++;
+
+			if (entry.View && entry.Context)
+			{
+				Run(entry.View, entry.Context, entry.Args);
+			}
+		}
+
+		if (m_QueueIndex >= m_Queue.Count())
+		{
+			m_Queue.Clear();
+			m_QueueIndex = 0;
+		} else if (m_QueueIndex > 256)
+		{
+			// Drop the processed front once it grows, a full screen can stay behind for a while
+			array<ref ViewUpdateEntry> remaining = new array<ref ViewUpdateEntry>();
+			for (int i = m_QueueIndex; i < m_Queue.Count(); i++)
+			{
+				remaining.Insert(m_Queue[i]);
+			}
+
+			m_Queue = remaining;
+			m_QueueIndex = 0;
+		}
+	}
+
+	protected static bool ShouldRun()
+	{
+		if (m_QueueIndex < m_Queue.Count())
+			return false;
+
+		return m_BudgetTicks <= 0 || m_FrameTicks < m_BudgetTicks;
+	}
+
+	protected static void Defer(ViewUpdateEntry entry)
+	{
+		m_Queue.Insert(entry);
+
+		if (m_StatsEnabled)
+		{
+			m_Frame.Deferred++;
+			GetControllerStats(entry.Context).Deferred++;
+		}
+	}
+
+	// There is no event when a parent is shown, so hidden bindings are checked once per frame
+	protected static void FlushVisible()
+	{
+		for (int i = m_HiddenViews.Count() - 1; i >= 0; i--)
+		{
+			ViewBinding view = m_HiddenViews[i];
+			if (view && view.IsHiddenInHierarchy())
+				continue;
+
+			m_HiddenViews.Remove(i);
+			if (!view)
+				continue;
+
+			array<ref ViewUpdateEntry> entries = view.TakeHiddenUpdates();
+			foreach (ViewUpdateEntry entry : entries)
+			{
+				if (!entry.Context)
+					continue;
+
+				if (entry.Args)
+				{
+					UpdateViewFromCollection(view, entry.Context, entry.Args);
+				} else
+				{
+					UpdateView(view, entry.Context);
+				}
+			}
+		}
+	}
+
+	protected static void Run(ViewBinding view, Controller controller, CollectionChangedEventArgs args)
+	{
+		// Checked here and not when queued so rolled over updates keep their order
+		if (LayoutBindingManager.DeferHiddenUpdates && view.IsHiddenInHierarchy())
+		{
+			if (view.AddHiddenUpdate(new ViewUpdateEntry(view, controller, args)))
+			{
+				m_HiddenViews.Insert(view);
+			}
+
+			return;
+		}
+
+		// Time is only needed for the stats or the budget
+		if (!m_StatsEnabled && m_BudgetTicks <= 0)
+		{
+			if (args)
+			{
+				view.UpdateViewFromCollection(args);
+			} else
+			{
+				view.UpdateView(controller);
+			}
+
+			return;
+		}
+
+		int start = TickCount(0);
+
+		if (args)
+		{
+			view.UpdateViewFromCollection(args);
+		} else
+		{
+			view.UpdateView(controller);
+		}
+
+		int ticks = TickCount(start);
+		m_FrameTicks += ticks;
+
+		if (!m_StatsEnabled)
+			return;
+
+		ViewUpdateStats controllerStats = GetControllerStats(controller);
+		if (args)
+		{
+			m_Frame.CollectionUpdates++;
+			controllerStats.CollectionUpdates++;
+		} else
+		{
+			m_Frame.PropertyUpdates++;
+			controllerStats.PropertyUpdates++;
+		}
+
+		m_Frame.Ticks += ticks;
+		controllerStats.Ticks += ticks;
+	}
+
+	protected static ViewUpdateStats GetControllerStats(Controller controller)
+	{
+		ViewUpdateStats stats = m_ControllerStats.Get(controller);
+		if (!stats)
+		{
+			stats = new ViewUpdateStats();
+			m_ControllerStats.Insert(controller, stats);
+		}
+
+		return stats;
+	}
+
+	protected static void UpdateOverlay()
+	{
+		string text = "MVC " + m_LastFrame.ToStringStats() + " pending=" + GetPendingCount();
+
+		foreach (Controller controller, ViewUpdateStats stats : m_LastControllerStats)
+		{
+			if (controller)
+			{
+				text += "\n" + controller.Type().ToString() + " " + stats.ToStringStats();
+			}
+		}
+
+		m_Overlay.SetText(text);
+	}
+}
@@ -340,13 +340,9 @@ class SpacerBaseWidgetController : WidgetControllerTemplate<SpacerBaseWidget>
 
 	override void InsertAt(int index, TypeConverter typeConverter)
 	{
-		if (index == Count())
-		{
-			Insert(typeConverter);
-		} else if (typeConverter.GetWidget())
+		if (typeConverter.GetWidget())
 		{
-			Widget widgetA = GetChildAtIndex(m_Widget, index);
-			m_Widget.AddChildAfter(typeConverter.GetWidget(), widgetA);
+			AddChildAt(index, typeConverter.GetWidget());
 		}
 	}
 
@@ -370,11 +366,10 @@ class SpacerBaseWidgetController : WidgetControllerTemplate<SpacerBaseWidget>
 
 	override void Move(int index, TypeConverter typeConverter)
 	{
-		Widget widgetA = GetChildAtIndex(m_Widget, index - 1);
-		if (typeConverter.GetWidget() && widgetA)
+		if (typeConverter.GetWidget())
 		{
 			m_Widget.RemoveChild(typeConverter.GetWidget());
-			m_Widget.AddChildAfter(typeConverter.GetWidget(), widgetA);
+			AddChildAt(index, typeConverter.GetWidget());
 		}
 	}
 
@@ -441,10 +436,32 @@ class SpacerBaseWidgetController : WidgetControllerTemplate<SpacerBaseWidget>
 
 		return result;
 	}
+
+	// Adds the child so it ends up at index, the child must not be in the widget
+	protected void AddChildAt(int index, Widget child)
+	{
+		Widget first = m_Widget.GetChildren();
+		if (!first || index >= Count())
+		{
+			m_Widget.AddChild(child);
+		} else if (index > 0)
+		{
+			m_Widget.AddChildAfter(child, GetChildAtIndex(m_Widget, index - 1));
+		} else
+		{
+			// There is no AddChildBefore, so add after the first child and move that one behind it
+			m_Widget.AddChildAfter(child, first);
+			m_Widget.RemoveChild(first);
+			m_Widget.AddChildAfter(first, child);
+		}
+	}
 };
 
 class XComboBoxWidgetController : WidgetControllerTemplate<XComboBoxWidget>
 {
+	// The combo box can't insert or read back items, so the texts are kept to rewrite the shifted ones
+	protected ref TStringArray m_Items = {};
+
 	override bool CanTwoWayBind()
 	{
 		return true;
@@ -462,29 +479,60 @@ class XComboBoxWidgetController : WidgetControllerTemplate<XComboBoxWidget>
 
 	override void Insert(TypeConverter typeConverter)
 	{
+		m_Items.Insert(typeConverter.GetString());
 		m_Widget.AddItem(typeConverter.GetString());
 	}
 
 	override void InsertAt(int index, TypeConverter typeConverter)
 	{
-		m_Widget.SetItem(index, typeConverter.GetString());
+		if (index >= m_Items.Count())
+		{
+			Insert(typeConverter);
+			return;
+		}
+
+		m_Items.InsertAt(typeConverter.GetString(), index);
+		m_Widget.AddItem(string.Empty);
+		UpdateItems(index, m_Items.Count() - 1);
 	}
 
 	override void Replace(int index, TypeConverter typeConverter)
 	{
-		InsertAt(index, typeConverter);
+		m_Items.Set(index, typeConverter.GetString());
+		m_Widget.SetItem(index, typeConverter.GetString());
 	}
 
 	override void Remove(int index, TypeConverter typeConverter)
 	{
+		m_Items.RemoveOrdered(index);
 		m_Widget.RemoveItem(index);
 	}
 
+	override void Move(int index, TypeConverter typeConverter)
+	{
+		int current = m_Items.Find(typeConverter.GetString());
+		if (current == -1 || current == index)
+			return;
+
+		m_Items.RemoveOrdered(current);
+		m_Items.InsertAt(typeConverter.GetString(), index);
+		UpdateItems(Math.Min(index, current), Math.Max(index, current));
+	}
+
 	override void Clear()
 	{
+		m_Items.Clear();
 		m_Widget.ClearAll();
 	}
 
+	protected void UpdateItems(int from, int to)
+	{
+		for (int i = from; i <= to; i++)
+		{
+			m_Widget.SetItem(i, m_Items[i]);
+		}
+	}
+
 	override int Count()
 	{
 		return m_Widget.GetNumItems();
@@ -525,13 +573,44 @@ class TextListboxController : WidgetControllerTemplate<TextListboxWidget>
 	}
 
 	override void InsertAt(int index, TypeConverter typeConverter)
+	{
+		m_Widget.AddItem(typeConverter.GetString(), typeConverter, 0, index);
+	}
+
+	override void Replace(int index, TypeConverter typeConverter)
 	{
 		m_Widget.SetItem(index, typeConverter.GetString(), typeConverter, 0);
 	}
 
 	override void Remove(int index, TypeConverter typeConverter)
 	{
-		m_Widget.SetItem(index, string.Empty, typeConverter, 0);
+		m_Widget.RemoveRow(index);
+	}
+
+	override void Move(int index, TypeConverter typeConverter)
+	{
+		// Rows before index are already in place when a CollectionView re-sorts, so look from index on first
+		string text = typeConverter.GetString();
+		int count = m_Widget.GetNumItems();
+		for (int j = 0; j < count; j++)
+		{
+			int i = (index + j) % count;
+
+			string row_text;
+			m_Widget.GetItemText(i, 0, row_text);
+			if (row_text != text)
+				continue;
+
+			if (i != index)
+			{
+				Class data;
+				m_Widget.GetItemData(i, 0, data);
+				m_Widget.RemoveRow(i);
+				m_Widget.AddItem(text, data, 0, index);
+			}
+
+			return;
+		}
 	}
 
 	override void Swap(int indexA, int indexB)
@@ -2,14 +2,29 @@ class JMModuleManagerBase
 {
 	protected bool m_PreventModuleBindings;
 
+	protected static int s_Generation;
+
 	void JMModuleManagerBase()
 	{
 		//GetLogger().Log( "JMModuleManagerBase::JMModuleManagerBase()", "JM_COT_ModuleFramework" );
+
+		s_Generation++;
 	}
 
 	void ~JMModuleManagerBase()
 	{
 		//GetLogger().Log( "JMModuleManagerBase::~JMModuleManagerBase()", "JM_COT_ModuleFramework" );
+
+		s_Generation++;
+	}
+
+	/**
+	 * @brief Changes whenever a module manager is created or destroyed, used to
+	 * invalidate module references cached by CF_Module
+	 */
+	static int GetGeneration()
+	{
+		return s_Generation;
 	}
 
 	bool IsPreventingModuleBindings()
@@ -0,0 +1,448 @@
+/**
+ * @brief One mod's data for one player, see CF_PlayerData
+ *
+ * @code
+ * class MyModPlayerData : CF_PlayerDataBase
+ * {
+ * 	int Kills;
+ *
+ * 	override void OnLoad()
+ * 	{
+ * 		JsonFileLoader< MyModPlayerData >.JsonLoadFile( "$profile:MyMod/" + GetPlayerId() + ".json", this );
+ * 	}
+ *
+ * 	override bool OnSave()
+ * 	{
+ * 		JsonFileLoader< MyModPlayerData >.JsonSaveFile( "$profile:MyMod/" + GetPlayerId() + ".json", this );
+ * 		return true;
+ * 	}
+ * }
+ * @endcode
+ */
+class CF_PlayerDataBase : Managed
+{
+	protected string m_PlayerId;
+	protected bool m_Dirty;
+
+	void _Init( string playerId )
+	{
+		m_PlayerId = playerId;
+	}
+
+	string GetPlayerId()
+	{
+		return m_PlayerId;
+	}
+
+	/**
+	 * @brief Call after changing the data, dirty records are saved on disconnect and never evicted unsaved
+	 */
+	void MarkDirty()
+	{
+		m_Dirty = true;
+	}
+
+	bool IsDirty()
+	{
+		return m_Dirty;
+	}
+
+	/**
+	 * @brief Reads the record, called once while the player is connecting
+	 */
+	void OnLoad()
+	{
+	}
+
+	/**
+	 * @brief Writes the record, return false to keep it dirty and try again later
+	 */
+	bool OnSave()
+	{
+		return true;
+	}
+
+	bool Save()
+	{
+		if ( !m_Dirty )
+			return true;
+
+		if ( OnSave() )
+			m_Dirty = false;
+
+		return !m_Dirty;
+	}
+};
+
+/**
+ * @brief Every registered record of one player
+ */
+class CF_PlayerDataSet : Managed
+{
+	protected string m_PlayerId;
+
+	protected ref map< typename, ref CF_PlayerDataBase > m_Records = new map< typename, ref CF_PlayerDataBase >();
+
+	//! Registered types not loaded yet
+	protected ref array< typename > m_Pending = new array< typename >();
+
+	//! GetGame().GetTime() of the disconnect, -1 while connected
+	protected int m_DisconnectTime = -1;
+
+	void CF_PlayerDataSet( string playerId, array< typename > types )
+	{
+		m_PlayerId = playerId;
+		m_Pending.Copy( types );
+	}
+
+	string GetPlayerId()
+	{
+		return m_PlayerId;
+	}
+
+	/**
+	 * @brief The record of the given type, loaded now if the preload hasn't reached it yet
+	 *
+	 * @code
+	 * MyModPlayerData data = MyModPlayerData.Cast( dataSet.Get( MyModPlayerData ) );
+	 * @endcode
+	 */
+	CF_PlayerDataBase Get( typename type )
+	{
+		if ( m_Pending.Find( type ) != -1 )
+			Load( type );
+
+		return m_Records.Get( type );
+	}
+
+	bool IsLoaded()
+	{
+		return m_Pending.Count() == 0;
+	}
+
+	/**
+	 * @brief Loads the next pending record, false once everything is loaded
+	 */
+	bool LoadNext()
+	{
+		if ( m_Pending.Count() == 0 )
+			return false;
+
+		Load( m_Pending[0] );
+		return true;
+	}
+
+	void LoadAll()
+	{
+		while ( LoadNext() )
+		{
+		}
+	}
+
+	bool IsDirty()
+	{
+		for ( int i = 0; i < m_Records.Count(); i++ )
+		{
+			if ( m_Records.GetElement( i ).IsDirty() )
+				return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief Saves the dirty records, false if any of them failed
+	 */
+	bool Save()
+	{
+		bool saved = true;
+		for ( int i = 0; i < m_Records.Count(); i++ )
+		{
+			if ( !m_Records.GetElement( i ).Save() )
+				saved = false;
+		}
+
+		return saved;
+	}
+
+	bool IsConnected()
+	{
+		return m_DisconnectTime == -1;
+	}
+
+	int GetDisconnectTime()
+	{
+		return m_DisconnectTime;
+	}
+
+	void _SetDisconnectTime( int time )
+	{
+		m_DisconnectTime = time;
+	}
+
+	protected void Load( typename type )
+	{
+		m_Pending.RemoveItem( type );
+
+		CF_PlayerDataBase record;
+		if ( !Class.CastTo( record, type.Spawn() ) )
+		{
+			Error( "CF_PlayerData: " + type.ToString() + " must inherit from CF_PlayerDataBase" );
+			return;
+		}
+
+		#ifdef CF_PROFILER
+		CF_Profiler.Begin( "CF_PlayerData::Load " + type.ToString() );
+		#endif
+
+		record._Init( m_PlayerId );
+		record.OnLoad();
+
+		#ifdef CF_PROFILER
+		CF_Profiler.End();
+		#endif
+
+		m_Records.Insert( type, record );
+	}
+};
+
+/**
+ * @brief Per player records of every mod, loaded while the player connects
+ *
+ * The module manager starts the preload in OnClientPrepare, a few records are
+ * read per frame until the player is ready, so a burst of connecting players
+ * doesn't read every file in one frame. JMModuleBase::OnClientReady receives
+ * the loaded set.
+ *
+ * After a disconnect dirty records are saved and the set is kept for a while,
+ * so a quick reconnect doesn't read the files again. Sets without unsaved
+ * changes are evicted once that time is over.
+ *
+ * Register types with JMModuleBase::RegisterPlayerData or CF.PlayerData.Register.
+ */
+class CF_PlayerData
+{
+	protected static ref array< typename > s_Types = new array< typename >();
+
+	//! Key is PlayerIdentity::GetId
+	protected static ref map< string, ref CF_PlayerDataSet > s_Sets = new map< string, ref CF_PlayerDataSet >();
+
+	//! Players with records left to preload, in connect order
+	protected static ref array< string > s_Queue = new array< string >();
+
+	protected static int s_LoadsPerFrame = 4;
+	protected static int s_EvictDelay = 300000;
+
+	protected static bool s_Loading;
+	protected static bool s_Evicting;
+
+	//!Single static instance. Do not create with new or spawn - use CF.PlayerData for access instead.
+	protected void CF_PlayerData();
+	protected void ~CF_PlayerData();
+
+	/**
+	 * @brief [Internal] CommunityFramework cleanup, saves every dirty record
+	 */
+	static void _Cleanup()
+	{
+		SaveAll();
+
+		Stop();
+
+		s_Sets.Clear();
+		s_Queue.Clear();
+	}
+
+	static void Register( typename type )
+	{
+		if ( !type.IsInherited( CF_PlayerDataBase ) )
+		{
+			Error( "CF_PlayerData: " + type.ToString() + " must inherit from CF_PlayerDataBase" );
+			return;
+		}
+
+		if ( s_Types.Find( type ) == -1 )
+			s_Types.Insert( type );
+	}
+
+	static void SetLoadsPerFrame( int count )
+	{
+		s_LoadsPerFrame = Math.Max( count, 1 );
+	}
+
+	/**
+	 * @brief How long the records of a disconnected player are kept
+	 */
+	static void SetEvictDelay( int milliseconds )
+	{
+		s_EvictDelay = milliseconds;
+	}
+
+	/**
+	 * @brief Starts loading the records of the player, reuses the cached set after a reconnect
+	 */
+	static void Preload( string playerId )
+	{
+		if ( s_Types.Count() == 0 )
+			return;
+
+		CF_PlayerDataSet dataSet = s_Sets.Get( playerId );
+		if ( dataSet )
+		{
+			dataSet._SetDisconnectTime( -1 );
+			return;
+		}
+
+		dataSet = new CF_PlayerDataSet( playerId, s_Types );
+		s_Sets.Insert( playerId, dataSet );
+
+		s_Queue.Insert( playerId );
+		Start();
+	}
+
+	/**
+	 * @brief The records of the player, whatever the preload hasn't reached yet is loaded now
+	 */
+	static CF_PlayerDataSet Get( string playerId )
+	{
+		CF_PlayerDataSet dataSet = s_Sets.Get( playerId );
+		if ( !dataSet )
+		{
+			Preload( playerId );
+
+			dataSet = s_Sets.Get( playerId );
+			if ( !dataSet )
+				return NULL;
+		}
+
+		if ( !dataSet.IsLoaded() )
+		{
+			dataSet.LoadAll();
+			s_Queue.RemoveItem( playerId );
+		}
+
+		return dataSet;
+	}
+
+	/**
+	 * @brief The records of the player if they are cached, without loading anything
+	 */
+	static CF_PlayerDataSet Find( string playerId )
+	{
+		return s_Sets.Get( playerId );
+	}
+
+	/**
+	 * @brief Saves the dirty records and starts the eviction timer of the player
+	 */
+	static void OnDisconnect( string playerId )
+	{
+		CF_PlayerDataSet dataSet = s_Sets.Get( playerId );
+		if ( !dataSet )
+			return;
+
+		s_Queue.RemoveItem( playerId );
+
+		dataSet.Save();
+		dataSet._SetDisconnectTime( GetGame().GetTime() );
+
+		if ( !s_Evicting )
+		{
+			s_Evicting = true;
+			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).CallLater( Evict, 10000, true );
+		}
+	}
+
+	static void SaveAll()
+	{
+		for ( int i = 0; i < s_Sets.Count(); i++ )
+			s_Sets.GetElement( i ).Save();
+	}
+
+	static int GetCachedCount()
+	{
+		return s_Sets.Count();
+	}
+
+	static int GetPendingCount()
+	{
+		return s_Queue.Count();
+	}
+
+	protected static void Start()
+	{
+		if ( s_Loading )
+			return;
+
+		s_Loading = true;
+		GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).CallLater( LoadStep, 0, true );
+	}
+
+	protected static void Stop()
+	{
+		if ( !GetGame() )
+			return;
+
+		if ( s_Loading )
+			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).Remove( LoadStep );
+
+		if ( s_Evicting )
+			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).Remove( Evict );
+
+		s_Loading = false;
+		s_Evicting = false;
+	}
+
+	//! Runs every frame while players are waiting for their records
+	protected static void LoadStep()
+	{
+		int loaded = 0;
+		while ( loaded < s_LoadsPerFrame && s_Queue.Count() > 0 )
+		{
+			CF_PlayerDataSet dataSet = s_Sets.Get( s_Queue[0] );
+			if ( !dataSet || !dataSet.LoadNext() )
+			{
+				s_Queue.RemoveOrdered( 0 );
+				continue;
+			}
+
+			loaded++;
+
+			if ( dataSet.IsLoaded() )
+				s_Queue.RemoveOrdered( 0 );
+		}
+
+		if ( s_Queue.Count() == 0 )
+		{
+			s_Loading = false;
+			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).Remove( LoadStep );
+		}
+	}
+
+	protected static void Evict()
+	{
+		int time = GetGame().GetTime();
+		int waiting = 0;
+
+		for ( int i = s_Sets.Count() - 1; i >= 0; i-- )
+		{
+			CF_PlayerDataSet dataSet = s_Sets.GetElement( i );
+			if ( dataSet.IsConnected() )
+				continue;
+
+			if ( time - dataSet.GetDisconnectTime() < s_EvictDelay || !dataSet.Save() )
+			{
+				waiting++;
+				continue;
+			}
+
+			s_Sets.RemoveElement( i );
+		}
+
+		if ( waiting == 0 )
+		{
+			s_Evicting = false;
+			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).Remove( Evict );
+		}
+	}
+};
@@ -73,13 +73,15 @@ class RPCManager
 	protected string m_UpdateChecker;
 
 	protected const int FRAMEWORK_RPC_ID = 10042;
-	protected autoptr map< string, ref map< string, ref RPCMetaWrapper > > m_RPCActions;
+
+	//! Keyed by the CF_StringPool ids of the mod and function names
+	protected autoptr map< int, ref map< int, ref RPCMetaWrapper > > m_RPCActions;
 
 	protected bool m_RPCManagerEnabled = false;
 
 	void RPCManager()
 	{
-		m_RPCActions = new map< string, ref map< string, ref RPCMetaWrapper > >;
+		m_RPCActions = new map< int, ref map< int, ref RPCMetaWrapper > >;
 		//GetLogger().OnUpdate.Insert( OnLogger );
 
 		m_UpdateChecker = "JM_CF_RPC";
@@ -226,11 +228,16 @@ class RPCManager
 
 		//GetLogger().Log( "Recieved RPC " + modName + "::" + funcName + " from " + recievedFrom + ", target " + target, m_UpdateChecker );
 		
-		map< string, ref RPCMetaWrapper > functions;
-		if ( m_RPCActions.Find( modName, functions ) )
+		#ifdef CF_PROFILER
+		CF_Profiler.Begin( "RPCManager::OnRPC" );
+		#endif
+
+		//! Names from the network are only looked up, never interned
+		map< int, ref RPCMetaWrapper > functions;
+		if ( m_RPCActions.Find( CF_StringPool.Find( modName ), functions ) )
 		{
 			RPCMetaWrapper wrapper;
-			if ( functions.Find( funcName, wrapper ) )
+			if ( functions.Find( CF_StringPool.Find( funcName ), wrapper ) )
 			{
 				if ( wrapper.GetInstance() )
 				{
@@ -260,6 +267,10 @@ class RPCManager
 		{
 			Error( recievedFrom + " tried sending <" + modName + ">::" + funcName + " which does not seem to exist!");
 		}
+
+		#ifdef CF_PROFILER
+		CF_Profiler.End();
+		#endif
 	}
 
 	void SendRPC( string modName, string funcName, ref Param params = NULL, bool guaranteed = false, ref PlayerIdentity sendToIdentity = NULL, ref Object sendToTarget = NULL )
@@ -290,17 +301,10 @@ class RPCManager
 		//In case we are in the singleplayer and the data is consumed twice for both client and server, we need to add it twice. Better than making a deep copy with more complicated rules on receiving
 		if ( !GetGame().IsMultiplayer() )
 		{
-			if ( m_RPCActions.Contains( modName ) )
+			ref RPCMetaWrapper wrapper = FindRPC( modName, funcName );
+			if ( wrapper && wrapper.GetSPExecutionType() == SingleplayerExecutionType.Both )
 			{
-				if ( m_RPCActions[ modName ].Contains( funcName ) )
-				{
-					ref RPCMetaWrapper wrapper = m_RPCActions[ modName ][ funcName ];
-					
-					if ( ( wrapper.GetSPExecutionType() == SingleplayerExecutionType.Both ) )
-					{
-						sendData.Insert( params );
-					}
-				}
+				sendData.Insert( params );
 			}
 		}
 
@@ -337,33 +341,38 @@ class RPCManager
 
 		if ( !GetGame().IsMultiplayer() )
 		{
-			if ( m_RPCActions.Contains( modName ) )
+			ref RPCMetaWrapper wrapper = FindRPC( modName, funcName );
+			if ( wrapper && wrapper.GetSPExecutionType() == SingleplayerExecutionType.Both )
 			{
-				if ( m_RPCActions[ modName ].Contains( funcName ) )
-				{
-					ref RPCMetaWrapper wrapper = m_RPCActions[ modName ][ funcName ];
-					
-					if ( ( wrapper.GetSPExecutionType() == SingleplayerExecutionType.Both ) )
-					{
-						Error( modName + "::" + funcName + " does not support \"SingleplayerExecutionType.Both\" when using RPCManager::SendRPCs, use RPCManager::SendRPC instead!");
-					}
-				}
+				Error( modName + "::" + funcName + " does not support \"SingleplayerExecutionType.Both\" when using RPCManager::SendRPCs, use RPCManager::SendRPC instead!");
 			}
 		}
 	}
 
+	protected RPCMetaWrapper FindRPC( string modName, string funcName )
+	{
+		map< int, ref RPCMetaWrapper > functions;
+		if ( !m_RPCActions.Find( CF_StringPool.Find( modName ), functions ) )
+			return NULL;
+
+		return functions.Get( CF_StringPool.Find( funcName ) );
+	}
+
 	bool AddRPC( string modName, string funcName, Class instance, int singlePlayerExecType = SingleplayerExecutionType.Server )
 	{
-		if ( !m_RPCActions.Contains( modName ) )
+		int modId = CF_StringPool.Intern( modName );
+		int funcId = CF_StringPool.Intern( funcName );
+
+		if ( !m_RPCActions.Contains( modId ) )
 		{
 			//GetLogger().Log( "Creating RPC mod " + modName, m_UpdateChecker );
-			m_RPCActions.Set( modName, new ref map< string, ref RPCMetaWrapper > );
+			m_RPCActions.Set( modId, new ref map< int, ref RPCMetaWrapper > );
 		}
 		
 		//GetLogger().Log( "Creating RPC function " + modName + "::" + funcName, m_UpdateChecker );
 		auto wrapper = new ref RPCMetaWrapper( instance, singlePlayerExecType );
 		
-		m_RPCActions[ modName ].Set( funcName, wrapper );
+		m_RPCActions[ modId ].Set( funcId, wrapper );
 
 		if ( !m_RPCManagerEnabled )
 		{
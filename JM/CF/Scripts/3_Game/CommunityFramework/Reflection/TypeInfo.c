@@ -0,0 +1,211 @@
+enum CF_FieldKind
+{
+	UNKNOWN = 0,
+	BOOL,
+	INT,
+	FLOAT,
+	STRING,
+	VECTOR,
+	CLASS,
+	ARRAY
+};
+
+/**
+ * @brief Reflection data of a single member variable, see CF_TypeInfo
+ */
+class CF_FieldInfo : Managed
+{
+	string Name;
+	typename Type;
+	CF_FieldKind Kind;
+
+	//! Interned through CF_StringPool, matches ConfigEntry::GetLowerNameId
+	int LowerNameId;
+
+	//! string::Hash of the name, identifies the field in binary files
+	int NameHash;
+
+	//! Only set when Kind is Array
+	typename ElementType;
+	CF_FieldKind ElementKind;
+
+	void CF_FieldInfo( string name, typename type )
+	{
+		Name = name;
+		Type = type;
+
+		string lowerName = name;
+		lowerName.ToLower();
+		LowerNameId = CF_StringPool.Intern( lowerName );
+
+		NameHash = name.Hash();
+
+		Kind = CF_TypeInfo.GetKind( type );
+
+		if ( Kind == CF_FieldKind.ARRAY )
+		{
+			ElementType = CF_TypeInfo.GetArrayElementType( type );
+			ElementKind = CF_TypeInfo.GetKind( ElementType );
+		}
+	}
+};
+
+/**
+ * @brief Member variables of a type, read through reflection once and cached
+ * for the rest of the session.
+ *
+ * @code
+ * CF_TypeInfo info = CF_TypeInfo.Get( MySettings );
+ * foreach ( CF_FieldInfo field : info.Fields )
+ * 	Print( field.Name );
+ * @endcode
+ */
+class CF_TypeInfo : Managed
+{
+	typename Type;
+
+	ref array< ref CF_FieldInfo > Fields = new array< ref CF_FieldInfo >();
+
+	protected ref map< int, CF_FieldInfo > m_FieldsByLowerName = new map< int, CF_FieldInfo >();
+	protected ref map< int, CF_FieldInfo > m_FieldsByHash = new map< int, CF_FieldInfo >();
+
+	//! Resolved case insensitive lookups by the original name id, includes misses
+	protected ref map< int, CF_FieldInfo > m_FieldsByNameId = new map< int, CF_FieldInfo >();
+
+	protected static ref map< typename, ref CF_TypeInfo > s_Cache = new map< typename, ref CF_TypeInfo >();
+
+	protected void CF_TypeInfo( typename type )
+	{
+		Type = type;
+
+		for ( int i = 0; i < type.GetVariableCount(); i++ )
+		{
+			CF_FieldInfo field = new CF_FieldInfo( type.GetVariableName( i ), type.GetVariableType( i ) );
+
+			Fields.Insert( field );
+			m_FieldsByLowerName.Insert( field.LowerNameId, field );
+
+			if ( !m_FieldsByHash.Insert( field.NameHash, field ) )
+				Error( "CF_TypeInfo: " + field.Name + " of " + type.ToString() + " has the same name hash as " + m_FieldsByHash.Get( field.NameHash ).Name );
+		}
+	}
+
+	static CF_TypeInfo Get( typename type )
+	{
+		CF_TypeInfo info;
+		if ( !s_Cache.Find( type, info ) )
+		{
+			info = new CF_TypeInfo( type );
+			s_Cache.Insert( type, info );
+		}
+
+		return info;
+	}
+
+	/**
+	 * @brief [Internal] CommunityFramework cleanup
+	 */
+	static void _Cleanup()
+	{
+		s_Cache.Clear();
+	}
+
+	/**
+	 * @brief Case insensitive lookup by an interned lowercase name
+	 */
+	CF_FieldInfo FindField( int lowerNameId )
+	{
+		return m_FieldsByLowerName.Get( lowerNameId );
+	}
+
+	CF_FieldInfo FindField( string name )
+	{
+		name.ToLower();
+		return FindField( CF_StringPool.Find( name ) );
+	}
+
+	/**
+	 * @brief Lookup by CF_FieldInfo::NameHash
+	 */
+	CF_FieldInfo FindFieldByHash( int nameHash )
+	{
+		return m_FieldsByHash.Get( nameHash );
+	}
+
+	/**
+	 * @brief Case insensitive lookup by an interned name in any case, the
+	 * result is remembered so only the first lookup lowers the name
+	 */
+	CF_FieldInfo FindFieldByNameId( int nameId )
+	{
+		CF_FieldInfo field;
+		if ( m_FieldsByNameId.Find( nameId, field ) )
+			return field;
+
+		field = FindField( CF_StringPool.Get( nameId ) );
+		m_FieldsByNameId.Insert( nameId, field );
+
+		return field;
+	}
+
+	static CF_FieldKind GetKind( typename type )
+	{
+		if ( !type )
+			return CF_FieldKind.UNKNOWN;
+
+		if ( type == bool )
+			return CF_FieldKind.BOOL;
+		if ( type == int )
+			return CF_FieldKind.INT;
+		if ( type == float )
+			return CF_FieldKind.FLOAT;
+		if ( type == string )
+			return CF_FieldKind.STRING;
+		if ( type == vector )
+			return CF_FieldKind.VECTOR;
+
+		if ( type.ToString().IndexOf( "array<" ) == 0 )
+			return CF_FieldKind.ARRAY;
+
+		if ( type.IsInherited( Class ) )
+			return CF_FieldKind.CLASS;
+
+		return CF_FieldKind.UNKNOWN;
+	}
+
+	/**
+	 * @brief The element type of "array<T>", reflection doesn't expose template arguments
+	 */
+	static typename GetArrayElementType( typename type )
+	{
+		string name = type.ToString();
+
+		int start = name.IndexOf( "<" ) + 1;
+		int end = name.LastIndexOf( ">" );
+		if ( start <= 0 || end <= start )
+		{
+			typename empty;
+			return empty;
+		}
+
+		name = name.Substring( start, end - start );
+		name.Replace( "ref ", "" );
+		name = name.Trim();
+
+		switch ( name )
+		{
+		case "bool":
+			return bool;
+		case "int":
+			return int;
+		case "float":
+			return float;
+		case "string":
+			return string;
+		case "vector":
+			return vector;
+		}
+
+		return name.ToType();
+	}
+};
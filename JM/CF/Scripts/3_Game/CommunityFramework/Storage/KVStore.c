@@ -0,0 +1,543 @@
+enum CF_KVType
+{
+	STRING = 0,
+	INT,
+	FLOAT,
+	BOOL,
+	VECTOR
+};
+
+class CF_KVValue : Managed
+{
+	CF_KVType Type;
+	string Value;
+
+	void CF_KVValue( CF_KVType type, string value )
+	{
+		Type = type;
+		Value = value;
+	}
+};
+
+/**
+ * @brief Key-value store backed by an append-only log in the profile folder.
+ *
+ * Every put or delete becomes one line appended on the next flush, so saving
+ * one player writes a few bytes instead of rewriting a whole file. The full
+ * index is kept in memory.
+ *
+ * The log is rewritten without the overwritten and deleted records once they
+ * outnumber the live ones. A compaction writes the other of two generation
+ * files (path.0 and path.1) and only deletes the old one once the new one is
+ * complete, so a crash at any point leaves a readable store.
+ *
+ * Each line carries a checksum, a torn last line from a crash is skipped by
+ * the recovery scan when the store is opened.
+ *
+ * @code
+ * CF_KVStore store = new CF_KVStore( "$profile:MyMod/players" );
+ * store.PutInt( uid + ".kills", kills );
+ * int deaths = store.GetInt( uid + ".deaths" );
+ * @endcode
+ */
+class CF_KVStore : Managed
+{
+	static const string MAGIC = "CFKV";
+	static const int VERSION = 1;
+
+	//! Put, delete, header and snapshot complete
+	static const string OP_PUT = "P";
+	static const string OP_DELETE = "D";
+	static const string OP_HEADER = "H";
+	static const string OP_SNAPSHOT = "S";
+
+	protected string m_Path;
+	protected int m_Generation = -1;
+
+	protected ref map< string, ref CF_KVValue > m_Index = new map< string, ref CF_KVValue >();
+
+	//! Lines not written to the log yet
+	protected ref array< string > m_Pending = new array< string >();
+
+	//! Records in the log that were overwritten or deleted since
+	protected int m_Garbage;
+
+	//! Replay skipped a bad line, the file is rewritten before anything is appended
+	protected bool m_Torn;
+	protected int m_MinCompactGarbage = 1000;
+
+	protected int m_FlushInterval;
+
+	/**
+	 * @param path				without extension, the generation number is appended
+	 * @param flushInterval		milliseconds between automatic flushes, 0 to only flush manually
+	 */
+	void CF_KVStore( string path, int flushInterval = 5000 )
+	{
+		m_Path = path;
+
+		Load();
+
+		SetFlushInterval( flushInterval );
+	}
+
+	void ~CF_KVStore()
+	{
+		if ( m_FlushInterval > 0 && GetGame() )
+			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).Remove( Flush );
+
+		Flush();
+	}
+
+	void SetFlushInterval( int milliseconds )
+	{
+		if ( m_FlushInterval > 0 && GetGame() )
+			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).Remove( Flush );
+
+		m_FlushInterval = milliseconds;
+
+		if ( m_FlushInterval > 0 && GetGame() )
+			GetGame().GetCallQueue( CALL_CATEGORY_SYSTEM ).CallLater( Flush, m_FlushInterval, true );
+	}
+
+	/**
+	 * @brief Compaction waits until this many records are garbage, and more than are alive
+	 */
+	void SetMinCompactGarbage( int records )
+	{
+		m_MinCompactGarbage = records;
+	}
+
+	int Count()
+	{
+		return m_Index.Count();
+	}
+
+	bool Contains( string key )
+	{
+		return m_Index.Contains( key );
+	}
+
+	CF_KVType GetType( string key )
+	{
+		CF_KVValue value = m_Index.Get( key );
+		if ( !value )
+			return CF_KVType.STRING;
+
+		return value.Type;
+	}
+
+	void GetKeys( out array< string > keys )
+	{
+		if ( !keys )
+			keys = new array< string >();
+
+		for ( int i = 0; i < m_Index.Count(); i++ )
+			keys.Insert( m_Index.GetKey( i ) );
+	}
+
+	void PutString( string key, string value )
+	{
+		Put( key, CF_KVType.STRING, value );
+	}
+
+	void PutInt( string key, int value )
+	{
+		Put( key, CF_KVType.INT, value.ToString() );
+	}
+
+	void PutFloat( string key, float value )
+	{
+		Put( key, CF_KVType.FLOAT, value.ToString() );
+	}
+
+	void PutBool( string key, bool value )
+	{
+		if ( value )
+		{
+			Put( key, CF_KVType.BOOL, "1" );
+		} else
+		{
+			Put( key, CF_KVType.BOOL, "0" );
+		}
+	}
+
+	void PutVector( string key, vector value )
+	{
+		Put( key, CF_KVType.VECTOR, value.ToString( false ) );
+	}
+
+	string GetString( string key, string defaultValue = "" )
+	{
+		CF_KVValue value = m_Index.Get( key );
+		if ( !value )
+			return defaultValue;
+
+		return value.Value;
+	}
+
+	int GetInt( string key, int defaultValue = 0 )
+	{
+		CF_KVValue value = m_Index.Get( key );
+		if ( !value )
+			return defaultValue;
+
+		return value.Value.ToInt();
+	}
+
+	float GetFloat( string key, float defaultValue = 0 )
+	{
+		CF_KVValue value = m_Index.Get( key );
+		if ( !value )
+			return defaultValue;
+
+		return value.Value.ToFloat();
+	}
+
+	bool GetBool( string key, bool defaultValue = false )
+	{
+		CF_KVValue value = m_Index.Get( key );
+		if ( !value )
+			return defaultValue;
+
+		return value.Value == "1";
+	}
+
+	vector GetVector( string key, vector defaultValue = "0 0 0" )
+	{
+		CF_KVValue value = m_Index.Get( key );
+		if ( !value )
+			return defaultValue;
+
+		return value.Value.ToVector();
+	}
+
+	void Delete( string key )
+	{
+		if ( !m_Index.Contains( key ) )
+			return;
+
+		m_Index.Remove( key );
+
+		//! Both the put and the delete record are garbage now
+		m_Garbage += 2;
+
+		m_Pending.Insert( MakeLine( OP_DELETE, key, "", "" ) );
+	}
+
+	/**
+	 * @brief Appends pending changes to the log in one write, compacts if enough of the log is garbage
+	 */
+	void Flush()
+	{
+		//! The index already holds the pending changes, the snapshot writes them too
+		if ( m_Torn )
+		{
+			Compact();
+			if ( !m_Torn )
+				return;
+		}
+
+		if ( m_Pending.Count() > 0 )
+		{
+			FileHandle handle = OpenFile( GetFile( m_Generation ), FileMode.APPEND );
+			if ( handle == 0 )
+			{
+				Error( "CF_KVStore: can't open " + GetFile( m_Generation ) + " for writing" );
+				return;
+			}
+
+			for ( int i = 0; i < m_Pending.Count(); i++ )
+				FPrintln( handle, m_Pending[i] );
+
+			CloseFile( handle );
+
+			m_Pending.Clear();
+		}
+
+		if ( m_Garbage >= m_MinCompactGarbage && m_Garbage > m_Index.Count() )
+			Compact();
+	}
+
+	/**
+	 * @brief Rewrites the live records into the next generation file
+	 */
+	void Compact()
+	{
+		int generation = m_Generation + 1;
+		if ( !WriteSnapshot( generation ) )
+			return;
+
+		DeleteFile( GetFile( m_Generation ) );
+
+		m_Generation = generation;
+		m_Garbage = 0;
+		m_Torn = false;
+		m_Pending.Clear();
+	}
+
+	protected void Put( string key, CF_KVType type, string value )
+	{
+		CF_KVValue existing = m_Index.Get( key );
+		if ( existing )
+		{
+			if ( existing.Type == type && existing.Value == value )
+				return;
+
+			existing.Type = type;
+			existing.Value = value;
+			m_Garbage++;
+		} else
+		{
+			m_Index.Insert( key, new CF_KVValue( type, value ) );
+		}
+
+		int typeId = type;
+		m_Pending.Insert( MakeLine( OP_PUT, key, typeId.ToString(), value ) );
+	}
+
+	protected string GetFile( int generation )
+	{
+		int slot = generation % 2;
+		return m_Path + "." + slot.ToString();
+	}
+
+	/**
+	 * @brief Recovery scan, picks the newest complete generation and replays its log
+	 */
+	protected void Load()
+	{
+		int generationA = ReadGeneration( GetFile( 0 ) );
+		int generationB = ReadGeneration( GetFile( 1 ) );
+
+		m_Generation = Math.Max( generationA, generationB );
+		if ( m_Generation == -1 )
+		{
+			if ( FileExist( GetFile( 0 ) ) || FileExist( GetFile( 1 ) ) )
+				Recover();
+
+			//! New store
+			WriteSnapshot( 0 );
+			m_Generation = 0;
+			return;
+		}
+
+		if ( !Replay( GetFile( m_Generation ) ) )
+		{
+			//! The newer file is an unfinished compaction, the older one is still intact
+			m_Generation = Math.Min( generationA, generationB );
+			m_Index.Clear();
+			m_Garbage = 0;
+			m_Torn = false;
+
+			if ( m_Generation == -1 || !Replay( GetFile( m_Generation ) ) )
+			{
+				Recover();
+
+				m_Index.Clear();
+				m_Garbage = 0;
+				m_Torn = false;
+
+				WriteSnapshot( 0 );
+				m_Generation = 0;
+				return;
+			}
+		}
+
+		DeleteFile( GetFile( m_Generation + 1 ) );
+
+		//! Appending after a torn line would glue the next record onto it
+		if ( m_Torn )
+			Compact();
+	}
+
+	//! Keeps unreadable files for inspection before the store starts over
+	protected void Recover()
+	{
+		Error( "CF_KVStore: " + m_Path + " could not be recovered, the files are kept as .corrupt" );
+
+		for ( int i = 0; i < 2; i++ )
+		{
+			string file = GetFile( i );
+			if ( FileExist( file ) )
+				CopyFile( file, file + ".corrupt" );
+		}
+	}
+
+	//! -1 if the file does not exist or has no valid header
+	protected int ReadGeneration( string file )
+	{
+		if ( !FileExist( file ) )
+			return -1;
+
+		FileHandle handle = OpenFile( file, FileMode.READ );
+		if ( handle == 0 )
+			return -1;
+
+		string line;
+		FGets( handle, line );
+		CloseFile( handle );
+
+		array< string > fields = new array< string >();
+		if ( !ParseLine( line, fields ) || fields[0] != OP_HEADER || fields[1] != MAGIC )
+			return -1;
+
+		return fields[3].ToInt();
+	}
+
+	//! false if the snapshot at the start of the file is incomplete
+	protected bool Replay( string file )
+	{
+		FileHandle handle = OpenFile( file, FileMode.READ );
+		if ( handle == 0 )
+			return false;
+
+		bool snapshotComplete = false;
+
+		array< string > fields = new array< string >();
+		string line;
+		while ( FGets( handle, line ) >= 0 )
+		{
+			if ( line == string.Empty )
+				continue;
+
+			//! Torn or corrupted record, only the last line can be torn so the rest is still read
+			if ( !ParseLine( line, fields ) )
+			{
+				m_Torn = true;
+				continue;
+			}
+
+			switch ( fields[0] )
+			{
+			case OP_SNAPSHOT:
+				snapshotComplete = true;
+				break;
+			case OP_PUT:
+				string key = fields[1];
+				if ( m_Index.Contains( key ) )
+					m_Garbage++;
+
+				m_Index.Set( key, new CF_KVValue( fields[2].ToInt(), fields[3] ) );
+				break;
+			case OP_DELETE:
+				if ( m_Index.Contains( fields[1] ) )
+				{
+					m_Index.Remove( fields[1] );
+					m_Garbage += 2;
+				}
+				break;
+			}
+		}
+
+		CloseFile( handle );
+		return snapshotComplete;
+	}
+
+	protected bool WriteSnapshot( int generation )
+	{
+		string file = GetFile( generation );
+
+		FileHandle handle = OpenFile( file, FileMode.WRITE );
+		if ( handle == 0 )
+		{
+			Error( "CF_KVStore: can't open " + file + " for writing" );
+			return false;
+		}
+
+		FPrintln( handle, MakeLine( OP_HEADER, MAGIC, VERSION.ToString(), generation.ToString() ) );
+
+		for ( int i = 0; i < m_Index.Count(); i++ )
+		{
+			CF_KVValue value = m_Index.GetElement( i );
+			int typeId = value.Type;
+			FPrintln( handle, MakeLine( OP_PUT, m_Index.GetKey( i ), typeId.ToString(), value.Value ) );
+		}
+
+		FPrintln( handle, MakeLine( OP_SNAPSHOT, "", "", "" ) );
+
+		CloseFile( handle );
+		return true;
+	}
+
+	//! op, key, type, value and a checksum of the four, tab separated
+	protected static string MakeLine( string op, string key, string type, string value )
+	{
+		string line = op + "\t" + Escape( key ) + "\t" + type + "\t" + Escape( value );
+		return line + "\t" + line.Hash().ToString();
+	}
+
+	//! Split by hand, string::Split drops the empty fields of deletes and empty values
+	protected static bool ParseLine( string line, out array< string > fields )
+	{
+		fields.Clear();
+
+		int start = 0;
+		for ( int i = 0; i < 4; i++ )
+		{
+			int end = line.IndexOfFrom( start, "\t" );
+			if ( end == -1 )
+				return false;
+
+			fields.Insert( line.Substring( start, end - start ) );
+			start = end + 1;
+		}
+
+		string checksum = line.Substring( start, line.Length() - start );
+		if ( checksum.IndexOf( "\t" ) != -1 )
+			return false;
+
+		string content = line.Substring( 0, start - 1 );
+		if ( content.Hash().ToString() != checksum )
+			return false;
+
+		fields[1] = Unescape( fields[1] );
+		fields[3] = Unescape( fields[3] );
+		return true;
+	}
+
+	protected static string Escape( string value )
+	{
+		value.Replace( "\\", "\\\\" );
+		value.Replace( "\t", "\\t" );
+		value.Replace( "\n", "\\n" );
+		value.Replace( "\r", "\\r" );
+		return value;
+	}
+
+	protected static string Unescape( string value )
+	{
+		if ( value.IndexOf( "\\" ) == -1 )
+			return value;
+
+		string result = "";
+		for ( int i = 0; i < value.Length(); i++ )
+		{
+			string c = value[i];
+			if ( c != "\\" || i + 1 >= value.Length() )
+			{
+				result += c;
+				continue;
+			}
+
+			i++;
+			switch ( value[i] )
+			{
+			case "t":
+				result += "\t";
+				break;
+			case "n":
+				result += "\n";
+				break;
+			case "r":
+				result += "\r";
+				break;
+			default:
+				result += value[i];
+				break;
+			}
+		}
+
+		return result;
+	}
+};
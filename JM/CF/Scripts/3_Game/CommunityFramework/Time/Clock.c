@@ -0,0 +1,198 @@
+/**
+ * @brief Wall clock of one frame, local or UTC
+ */
+class CF_ClockSample : Managed
+{
+	bool UseUTC;
+
+	int Year;
+	int Month;
+	int Day;
+	int Hour;
+	int Minute;
+	int Second;
+
+	//! CF_Clock frame the values are from, -1 before the first sample
+	int Frame = -1;
+
+	protected int m_Timestamp = -1;
+
+	//! Formatted strings of this frame by format
+	protected ref map< string, string > m_Formatted = new map< string, string >();
+
+	void CF_ClockSample( bool useUTC )
+	{
+		UseUTC = useUTC;
+	}
+
+	void Sample( int frame )
+	{
+		if ( UseUTC )
+		{
+			GetYearMonthDayUTC( Year, Month, Day );
+			GetHourMinuteSecondUTC( Hour, Minute, Second );
+		} else
+		{
+			GetYearMonthDay( Year, Month, Day );
+			GetHourMinuteSecond( Hour, Minute, Second );
+		}
+
+		Frame = frame;
+		m_Timestamp = -1;
+		m_Formatted.Clear();
+	}
+
+	int GetTimestamp()
+	{
+		if ( m_Timestamp == -1 )
+			m_Timestamp = JMDate.Timestamp( Year, Month, Day, Hour, Minute, Second );
+
+		return m_Timestamp;
+	}
+
+	string Format( string format )
+	{
+		string formatted;
+		if ( !m_Formatted.Find( format, formatted ) )
+		{
+			formatted = JMDate.Now( UseUTC ).ToString( format );
+			m_Formatted.Insert( format, formatted );
+		}
+
+		return formatted;
+	}
+};
+
+/**
+ * @brief Time sampled once per frame, for code that timestamps many events.
+ *
+ * The wall clock is read from the engine on the first request of a frame and
+ * shared by every later request in the same frame. Formatted strings are
+ * cached per format for the frame as well.
+ *
+ * @code
+ * int now = CF.Clock.GetUnixTime();
+ * string time = CF.Clock.Format( "hh:mm:ss" );
+ *
+ * int start = CF.Clock.GetMilliseconds();
+ * ...
+ * int elapsed = CF.Clock.GetMilliseconds() - start;
+ * @endcode
+ */
+class CF_Clock
+{
+	protected static int s_Frame;
+
+	//! Seconds of the last frame
+	protected static float s_DeltaTime;
+
+	//! Milliseconds since the clock started, never goes back. Kept as an
+	//! integer, a float total stops counting single milliseconds after a few hours.
+	protected static int s_Milliseconds;
+
+	//! Ticks of the last frames that did not add up to a whole millisecond yet
+	protected static int s_RemainderTicks;
+	protected static int s_LastTick;
+	protected static bool s_Started;
+
+	protected static ref CF_ClockSample s_Local = new CF_ClockSample( false );
+	protected static ref CF_ClockSample s_UTC = new CF_ClockSample( true );
+
+	//!Single static instance. Do not create with new or spawn - use CF.Clock for access instead.
+	protected void CF_Clock();
+	protected void ~CF_Clock();
+
+	/**
+	 * @brief [Internal] Called at the start of every frame by DayZGame
+	 */
+	static void _OnFrame()
+	{
+		int tick = TickCount( 0 );
+
+		if ( s_Started )
+		{
+			//! TickCount is in 100 nanoseconds, differences survive the wrap around
+			int ticks = tick - s_LastTick;
+			s_DeltaTime = ticks / 10000000.0;
+
+			s_RemainderTicks += ticks;
+			s_Milliseconds += s_RemainderTicks / 10000;
+			s_RemainderTicks = s_RemainderTicks % 10000;
+		}
+
+		s_Started = true;
+		s_LastTick = tick;
+		s_Frame++;
+	}
+
+	/**
+	 * @brief Frames since the game started
+	 */
+	static int GetFrame()
+	{
+		return s_Frame;
+	}
+
+	static float GetDeltaTime()
+	{
+		return s_DeltaTime;
+	}
+
+	/**
+	 * @brief Monotonic milliseconds at the start of this frame, for measuring elapsed time
+	 */
+	static int GetMilliseconds()
+	{
+		return s_Milliseconds;
+	}
+
+	static float GetSeconds()
+	{
+		return ( s_Milliseconds / 1000 ) + ( s_Milliseconds % 1000 ) / 1000.0;
+	}
+
+	/**
+	 * @brief Seconds since 1970 in UTC
+	 */
+	static int GetUnixTime()
+	{
+		return GetSample( true ).GetTimestamp();
+	}
+
+	/**
+	 * @brief See JMDate::ToString for the format
+	 */
+	static string Format( string format, bool useUTC = false )
+	{
+		return GetSample( useUTC ).Format( format );
+	}
+
+	static void GetDate( bool useUTC, out int year, out int month, out int day )
+	{
+		CF_ClockSample sample = GetSample( useUTC );
+		year = sample.Year;
+		month = sample.Month;
+		day = sample.Day;
+	}
+
+	static void GetTime( bool useUTC, out int hour, out int minute, out int second )
+	{
+		CF_ClockSample sample = GetSample( useUTC );
+		hour = sample.Hour;
+		minute = sample.Minute;
+		second = sample.Second;
+	}
+
+	static CF_ClockSample GetSample( bool useUTC )
+	{
+		CF_ClockSample sample = s_Local;
+		if ( useUTC )
+			sample = s_UTC;
+
+		//! Before the first frame every request samples again
+		if ( sample.Frame != s_Frame || s_Frame == 0 )
+			sample.Sample( s_Frame );
+
+		return sample;
+	}
+};
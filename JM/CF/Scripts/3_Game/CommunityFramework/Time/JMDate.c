@@ -23,15 +23,9 @@ class JMDate : Managed
         ref JMDate date = new JMDate();
         date.m_UseUTC = useUTC;
 
-        if ( date.m_UseUTC )
-        {
-            GetYearMonthDayUTC( date.m_Year, date.m_Month, date.m_Day );
-            GetHourMinuteSecondUTC( date.m_Hour, date.m_Minute, date.m_Second );
-        } else
-        {
-            GetYearMonthDay( date.m_Year, date.m_Month, date.m_Day );
-            GetHourMinuteSecond( date.m_Hour, date.m_Minute, date.m_Second );
-        }
+        //! Shares the sample of the current frame instead of asking the engine every call
+        CF_Clock.GetDate( useUTC, date.m_Year, date.m_Month, date.m_Day );
+        CF_Clock.GetTime( useUTC, date.m_Hour, date.m_Minute, date.m_Second );
 
         return date;
     }
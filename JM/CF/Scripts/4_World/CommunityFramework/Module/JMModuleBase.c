@@ -2,7 +2,10 @@ class JMModuleBase
 {
 	protected bool m_Enabled;
 	protected bool m_PreventInput;
+	protected bool m_Initialized;
 	protected ref set< ref JMModuleBinding > m_Bindings;
+
+	protected static int s_BindingsRevision;
 	
 	void JMModuleBase()
 	{
@@ -20,6 +23,60 @@ class JMModuleBase
 		RegisterKeyMouseBindings();
 	}
 
+	/**
+	 * @brief Modules which have to finish initialising before this one is initialised.
+	 * Modules which aren't loaded on this side are ignored.
+	 */
+	void RegisterDependencies( out array< typename > dependencies )
+	{
+	}
+
+	/**
+	 * @brief CF_PlayerDataBase types preloaded for every connecting player,
+	 * see OnClientReady( PlayerBase, PlayerIdentity, CF_PlayerDataSet )
+	 */
+	void RegisterPlayerData( out array< typename > types )
+	{
+	}
+
+	/**
+	 * @brief Orders modules that don't depend on each other
+	 */
+	JMModuleInitPhase GetInitPhase()
+	{
+		return JMModuleInitPhase.Default;
+	}
+
+	/**
+	 * @brief If true, InitAsync runs in a script thread after Init and the
+	 * module only receives events once it has returned.
+	 */
+	bool IsInitAsync()
+	{
+		return false;
+	}
+
+	/**
+	 * @brief Heavy initialisation such as loading settings or building caches.
+	 * When IsInitAsync is true this may call Sleep to spread the work over frames.
+	 */
+	void InitAsync()
+	{
+	}
+
+	bool IsInitialized()
+	{
+		return m_Initialized;
+	}
+
+	/**
+	 * @brief [Internal] Called by the module manager once InitAsync has returned
+	 */
+	void _SetInitialized()
+	{
+		m_Initialized = true;
+	}
+
 	void Toggle()
 	{
 		m_Enabled = !m_Enabled;
@@ -40,6 +97,9 @@ class JMModuleBase
 		return GetModuleName().ToType();
 	}
 
+	/**
+	 * @brief Modules only receive events once they are also initialised, see IsInitialized
+	 */
 	bool IsEnabled()
 	{
 		return m_Enabled;
@@ -84,6 +144,17 @@ class JMModuleBase
 	void RegisterBinding( JMModuleBinding binding ) 
 	{
 		m_Bindings.Insert( binding );
+
+		s_BindingsRevision++;
+	}
+
+	/**
+	 * @brief Changes whenever a binding is registered, the module manager
+	 * rebuilds its input table when it does
+	 */
+	static int GetBindingsRevision()
+	{
+		return s_BindingsRevision;
 	}
 	
 	set< ref JMModuleBinding > GetBindings()
@@ -238,6 +309,13 @@ class JMModuleBase
 	{
 	}
 
+	/**
+	 * @brief After OnClientReady, with the player's records already loaded, see RegisterPlayerData
+	 */
+	void OnClientReady( PlayerBase player, PlayerIdentity identity, CF_PlayerDataSet data )
+	{
+	}
+
 	/**
 	 * @brief See: ClientPrepareEventTypeID
 	 */
@@ -252,6 +330,53 @@ class JMModuleBase
 	{
 	}
 
+	/**
+	 * @brief If true, the *Deferred player events below are queued by the
+	 * module manager and run a few at a time over the following frames.
+	 *
+	 * Events are run in order per player, players take turns and the queue
+	 * of a player is dropped when they disconnect.
+	 */
+	bool HasDeferredClientEvents()
+	{
+		return false;
+	}
+
+	/**
+	 * @brief Deferred OnInvokeConnect, see HasDeferredClientEvents
+	 */
+	void OnInvokeConnectDeferred( PlayerBase player, PlayerIdentity identity )
+	{
+	}
+
+	/**
+	 * @brief Deferred OnClientNew, see HasDeferredClientEvents
+	 */
+	void OnClientNewDeferred( PlayerBase player, PlayerIdentity identity )
+	{
+	}
+
+	/**
+	 * @brief Deferred OnClientReady, see HasDeferredClientEvents
+	 */
+	void OnClientReadyDeferred( PlayerBase player, PlayerIdentity identity )
+	{
+	}
+
+	/**
+	 * @brief Deferred OnClientReconnect, see HasDeferredClientEvents
+	 */
+	void OnClientReconnectDeferred( PlayerBase player, PlayerIdentity identity )
+	{
+	}
+
+	/**
+	 * @brief Deferred OnClientRespawn, see HasDeferredClientEvents
+	 */
+	void OnClientRespawnDeferred( PlayerBase player, PlayerIdentity identity )
+	{
+	}
+
 	/**
 	 * @brief See: ClientDisconnectedEventTypeID
 	 */
@@ -0,0 +1,97 @@
+/**
+ * @brief All module bindings subscribed to one UAInput. The input is polled
+ * once per frame and the subscribers are only called when its state changed.
+ */
+class JMModuleBindingInput
+{
+	protected UAInput m_Input;
+	protected ref Param1< UAInput > m_Params;
+
+	protected bool m_IsLimited;
+	protected bool m_CanPress;
+	protected bool m_CanRelease;
+	protected bool m_CanHold;
+	protected bool m_CanClick;
+	protected bool m_CanDoubleClick;
+
+	protected float m_LastValue;
+
+	protected autoptr array< JMModuleBase > m_Modules;
+	protected autoptr array< JMModuleBinding > m_Bindings;
+
+	void JMModuleBindingInput( UAInput input )
+	{
+		m_Input = input;
+		m_Params = new Param1< UAInput >( input );
+
+		m_CanPress = input.IsPressLimit();
+		m_CanRelease = input.IsReleaseLimit();
+		m_CanHold = input.IsHoldLimit();
+		m_CanClick = input.IsClickLimit();
+		m_CanDoubleClick = input.IsDoubleClickLimit();
+
+		m_IsLimited = m_CanPress || m_CanRelease || m_CanHold || m_CanClick || m_CanDoubleClick;
+
+		m_Modules = new array< JMModuleBase >;
+		m_Bindings = new array< JMModuleBinding >;
+	}
+
+	void Subscribe( JMModuleBase module, JMModuleBinding binding )
+	{
+		m_Modules.Insert( module );
+		m_Bindings.Insert( binding );
+	}
+
+	/**
+	 * @brief How many times the subscribers have to be called this frame.
+	 *
+	 * Limited inputs fire once per matching event. Other inputs fire every
+	 * frame they are held and once more on the frame they are released.
+	 */
+	int Poll()
+	{
+		if ( !m_IsLimited )
+		{
+			float value = m_Input.LocalValue();
+			if ( value == 0 && m_LastValue == 0 )
+				return 0;
+
+			m_LastValue = value;
+			return 1;
+		}
+
+		int count = 0;
+
+		if ( m_CanPress && m_Input.LocalPress() )
+			count++;
+		if ( m_CanRelease && m_Input.LocalRelease() )
+			count++;
+		if ( m_CanHold && m_Input.LocalHold() )
+			count++;
+		if ( m_CanClick && m_Input.LocalClick() )
+			count++;
+		if ( m_CanDoubleClick && m_Input.LocalDoubleClick() )
+			count++;
+
+		return count;
+	}
+
+	void Dispatch( int count, bool inMenu )
+	{
+		for ( int i = 0; i < m_Modules.Count(); i++ )
+		{
+			JMModuleBase module = m_Modules[i];
+			if ( !module.IsEnabled() || !module.IsInitialized() || module.IsPreventingInput() )
+				continue;
+
+			JMModuleBinding binding = m_Bindings[i];
+			if ( inMenu && !binding.CanBeUsedInMenu() )
+				continue;
+
+			for ( int j = 0; j < count; j++ )
+			{
+				GetGame().GameScript.CallFunctionParams( module, binding.GetCallBackFunction(), NULL, m_Params );
+			}
+		}
+	}
+}
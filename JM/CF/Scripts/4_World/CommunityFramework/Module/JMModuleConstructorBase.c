@@ -1,5 +1,7 @@
 class JMModuleConstructorBase
 {
+	protected autoptr map< typename, int > m_ModuleSides = new map< typename, int >;
+
 	void Generate( out map< typename, ref JMModuleBase > moduleMap, out array< JMModuleBase > moduleArr )
 	{
 		array< typename > moduleArrayNames = new array< typename >;
@@ -7,12 +9,25 @@ class JMModuleConstructorBase
 
 		moduleMap = new map< typename, ref JMModuleBase >;
 		moduleArr = new array< JMModuleBase >;
+
+		int sides = 0;
+		if ( IsMissionHost() )
+			sides |= JMModuleSide.Server;
+		if ( IsMissionClient() )
+			sides |= JMModuleSide.Client;
 		
 		for ( int idx = 0; idx < moduleArrayNames.Count(); idx++ )
 		{
 			typename moduleType = moduleArrayNames[ idx ];
 			if ( moduleType.IsInherited( JMModuleBase ) )
 			{
+				int side;
+				if ( m_ModuleSides.Find( moduleType, side ) && ( side & sides ) == 0 )
+				{
+					Print( "Skipped Module: " + moduleType.ToString() );
+					continue;
+				}
+
 				ref JMModuleBase module = JMModuleBase.Cast( moduleType.Spawn() );
 
 				if ( IsMissionHost() )
@@ -46,7 +61,29 @@ class JMModuleConstructorBase
 		}
 	}
 
+	/**
+	 * @brief Registers a module along with the sides it runs on. Modules that
+	 * don't run on the current side are never constructed.
+	 *
+	 * Modules inserted into the array directly are still constructed and then
+	 * checked with JMModuleBase::IsServer and JMModuleBase::IsClient.
+	 *
+	 * @code
+	 * override void RegisterModules( out array< typename > modules )
+	 * {
+	 * 	super.RegisterModules( modules );
+	 *
+	 * 	RegisterModule( modules, MyServerModule, JMModuleSide.Server );
+	 * }
+	 * @endcode
+	 */
+	void RegisterModule( out array< typename > modules, typename type, int side = JMModuleSide.Both )
+	{
+		modules.Insert( type );
+		m_ModuleSides.Set( type, side );
+	}
+
 	void RegisterModules( out array< typename > modules )
 	{
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,52 @@
+enum JMModuleDeferredEventType
+{
+	InvokeConnect = 0,
+	ClientNew,
+	ClientReady,
+	ClientReconnect,
+	ClientRespawn
+}
+
+class JMModuleDeferredEvent
+{
+	protected JMModuleBase m_Module;
+	protected JMModuleDeferredEventType m_Type;
+
+	protected PlayerBase m_Player;
+	protected PlayerIdentity m_Identity;
+
+	void JMModuleDeferredEvent( JMModuleBase module, JMModuleDeferredEventType type, PlayerBase player, PlayerIdentity identity )
+	{
+		m_Module = module;
+		m_Type = type;
+
+		m_Player = player;
+		m_Identity = identity;
+	}
+
+	void Execute()
+	{
+		//! The player may have left since the event was queued
+		if ( !m_Identity || !m_Module.IsEnabled() || !m_Module.IsInitialized() )
+			return;
+
+		switch ( m_Type )
+		{
+		case JMModuleDeferredEventType.InvokeConnect:
+			m_Module.OnInvokeConnectDeferred( m_Player, m_Identity );
+			break;
+		case JMModuleDeferredEventType.ClientNew:
+			m_Module.OnClientNewDeferred( m_Player, m_Identity );
+			break;
+		case JMModuleDeferredEventType.ClientReady:
+			m_Module.OnClientReadyDeferred( m_Player, m_Identity );
+			break;
+		case JMModuleDeferredEventType.ClientReconnect:
+			m_Module.OnClientReconnectDeferred( m_Player, m_Identity );
+			break;
+		case JMModuleDeferredEventType.ClientRespawn:
+			m_Module.OnClientRespawnDeferred( m_Player, m_Identity );
+			break;
+		}
+	}
+}
@@ -0,0 +1,10 @@
+/**
+ * @brief Coarse ordering of module initialisation. Dependencies always come
+ * first, the phase only orders modules that don't depend on each other.
+ */
+enum JMModuleInitPhase
+{
+	Early = 0,
+	Default,
+	Late
+}
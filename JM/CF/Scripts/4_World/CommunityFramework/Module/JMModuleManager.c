@@ -8,6 +8,25 @@ class JMModuleManager: JMModuleManagerBase
 
 	protected autoptr array< JMModuleBase > m_ModuleList;
 
+	protected autoptr map< JMModuleBase, ref array< JMModuleBase > > m_Dependencies;
+	protected autoptr array< JMModuleBase > m_PendingInit;
+
+	protected autoptr array< JMModuleBase > m_DeferredModules;
+	protected autoptr map< string, ref array< ref JMModuleDeferredEvent > > m_DeferredEvents;
+	protected autoptr array< string > m_DeferredPlayers;
+	protected int m_DeferredPlayerIndex;
+	protected int m_DeferredEventsPerFrame = 4;
+
+	protected autoptr array< ref JMModuleBindingInput > m_BindingInputs;
+	protected int m_BindingsRevision = -1;
+
+	protected Widget m_FocusedWidget;
+	protected bool m_IsInputFocused;
+
+	protected bool m_OnInitCalled;
+	protected bool m_MissionStarted;
+	protected bool m_MissionLoaded;
+
 	void JMModuleManager()
 	{
 		//GetLogger().Log( "JMModuleManager::JMModuleManager()", "JM_COT_ModuleFramework" );
@@ -21,6 +40,267 @@ class JMModuleManager: JMModuleManagerBase
 	void ConstructModules( JMModuleConstructorBase construct )
 	{
 		construct.Generate( m_Modules, m_ModuleList );
+
+		SortModules();
+	}
+
+	/**
+	 * @brief Orders the module list so every module comes after its dependencies,
+	 * then by init phase, then by registration order.
+	 */
+	protected void SortModules()
+	{
+		int count = m_ModuleList.Count();
+		int i;
+		int j;
+
+		m_Dependencies = new map< JMModuleBase, ref array< JMModuleBase > >;
+
+		map< typename, int > indices = new map< typename, int >;
+		array< ref array< int > > dependents = new array< ref array< int > >;
+		array< int > unresolved = new array< int >;
+		array< int > phases = new array< int >;
+		array< bool > sorted = new array< bool >;
+
+		for ( i = 0; i < count; i++ )
+		{
+			indices.Insert( m_ModuleList[i].Type(), i );
+			dependents.Insert( new array< int > );
+			unresolved.Insert( 0 );
+			phases.Insert( m_ModuleList[i].GetInitPhase() );
+			sorted.Insert( false );
+		}
+
+		array< typename > types = new array< typename >;
+		for ( i = 0; i < count; i++ )
+		{
+			array< JMModuleBase > dependencies = new array< JMModuleBase >;
+			m_Dependencies.Insert( m_ModuleList[i], dependencies );
+
+			types.Clear();
+			m_ModuleList[i].RegisterDependencies( types );
+
+			for ( j = 0; j < types.Count(); j++ )
+			{
+				int index;
+				if ( !indices.Find( types[j], index ) || index == i )
+					continue;
+
+				dependencies.Insert( m_ModuleList[index] );
+				dependents[index].Insert( i );
+				unresolved[i] = unresolved[i] + 1;
+			}
+		}
+
+		array< JMModuleBase > order = new array< JMModuleBase >;
+		while ( order.Count() < count )
+		{
+			int next = -1;
+			for ( i = 0; i < count; i++ )
+			{
+				if ( sorted[i] || unresolved[i] > 0 )
+					continue;
+
+				if ( next == -1 || phases[i] < phases[next] )
+					next = i;
+			}
+
+			if ( next == -1 )
+			{
+				for ( i = 0; i < count; i++ )
+				{
+					if ( sorted[i] )
+						continue;
+
+					Error( "Module " + m_ModuleList[i].GetModuleName() + " has a circular dependency, falling back to registration order" );
+					order.Insert( m_ModuleList[i] );
+
+					//! Only the edges to other modules of the cycle are dropped, so CanInitModule lets them start in this order
+					dependencies = m_Dependencies.Get( m_ModuleList[i] );
+					for ( j = dependencies.Count() - 1; j >= 0; j-- )
+					{
+						if ( !sorted[indices.Get( dependencies[j].Type() )] )
+							dependencies.Remove( j );
+					}
+				}
+
+				break;
+			}
+
+			sorted[next] = true;
+			order.Insert( m_ModuleList[next] );
+
+			for ( i = 0; i < dependents[next].Count(); i++ )
+			{
+				int dependent = dependents[next][i];
+				unresolved[dependent] = unresolved[dependent] - 1;
+			}
+		}
+
+		m_ModuleList.Clear();
+		m_ModuleList.InsertAll( order );
+
+		m_DeferredModules = new array< JMModuleBase >;
+		m_DeferredEvents = new map< string, ref array< ref JMModuleDeferredEvent > >;
+		m_DeferredPlayers = new array< string >;
+
+		for ( i = 0; i < count; i++ )
+		{
+			if ( m_ModuleList[i].HasDeferredClientEvents() )
+				m_DeferredModules.Insert( m_ModuleList[i] );
+		}
+	}
+
+	/**
+	 * @brief Maximum number of deferred player events run per frame
+	 */
+	void SetDeferredEventsPerFrame( int count )
+	{
+		m_DeferredEventsPerFrame = Math.Max( count, 1 );
+	}
+
+	int GetDeferredEventsPerFrame()
+	{
+		return m_DeferredEventsPerFrame;
+	}
+
+	protected void QueueDeferredEvents( JMModuleDeferredEventType type, PlayerBase player, PlayerIdentity identity )
+	{
+		if ( m_DeferredModules.Count() == 0 || !identity )
+			return;
+
+		string uid = identity.GetId();
+
+		array< ref JMModuleDeferredEvent > events = m_DeferredEvents.Get( uid );
+		if ( !events )
+		{
+			events = new array< ref JMModuleDeferredEvent >;
+			m_DeferredEvents.Insert( uid, events );
+			m_DeferredPlayers.Insert( uid );
+		}
+
+		for ( int i = 0; i < m_DeferredModules.Count(); i++ )
+		{
+			events.Insert( new JMModuleDeferredEvent( m_DeferredModules[i], type, player, identity ) );
+		}
+	}
+
+	protected void RemoveDeferredEvents( string uid )
+	{
+		int index = m_DeferredPlayers.Find( uid );
+		if ( index == -1 )
+			return;
+
+		m_DeferredPlayers.RemoveOrdered( index );
+		m_DeferredEvents.Remove( uid );
+
+		if ( m_DeferredPlayerIndex > index )
+			m_DeferredPlayerIndex--;
+	}
+
+	/**
+	 * @brief Runs queued player events, one player at a time in turn so a
+	 * burst of connections doesn't starve the players at the end of the queue.
+	 */
+	protected void ProcessDeferredEvents()
+	{
+		int processed = 0;
+		while ( processed < m_DeferredEventsPerFrame && m_DeferredPlayers.Count() > 0 )
+		{
+			if ( m_DeferredPlayerIndex >= m_DeferredPlayers.Count() )
+				m_DeferredPlayerIndex = 0;
+
+			string uid = m_DeferredPlayers[m_DeferredPlayerIndex];
+			array< ref JMModuleDeferredEvent > events = m_DeferredEvents.Get( uid );
+
+			//! Keep the event alive while it runs, the queue may be dropped from inside it
+			ref JMModuleDeferredEvent evt = events[0];
+			events.RemoveOrdered( 0 );
+
+			if ( events.Count() == 0 )
+			{
+				RemoveDeferredEvents( uid );
+			} else
+			{
+				m_DeferredPlayerIndex++;
+			}
+
+			evt.Execute();
+			processed++;
+		}
+	}
+
+	/**
+	 * @brief Groups the bindings of all modules by input so each input is polled once per frame
+	 */
+	protected void BuildBindingInputs()
+	{
+		m_BindingsRevision = JMModuleBase.GetBindingsRevision();
+
+		m_BindingInputs = new array< ref JMModuleBindingInput >;
+		map< string, JMModuleBindingInput > inputs = new map< string, JMModuleBindingInput >;
+
+		for ( int i = 0; i < m_ModuleList.Count(); i++ )
+		{
+			JMModuleBase module = m_ModuleList[i];
+			set< ref JMModuleBinding > bindings = module.GetBindings();
+
+			for ( int j = 0; j < bindings.Count(); j++ )
+			{
+				JMModuleBinding binding = bindings.Get( j );
+				string inputName = binding.GetUAInputName();
+
+				JMModuleBindingInput bindingInput;
+				if ( !inputs.Find( inputName, bindingInput ) )
+				{
+					UAInput input = GetUApi().GetInputByName( inputName );
+					if ( !input )
+					{
+						Error( module.GetModuleName() + " has a binding for input " + inputName + " which does not exist" );
+						continue;
+					}
+
+					bindingInput = new JMModuleBindingInput( input );
+					inputs.Insert( inputName, bindingInput );
+					m_BindingInputs.Insert( bindingInput );
+				}
+
+				bindingInput.Subscribe( module, binding );
+			}
+		}
+	}
+
+	/**
+	 * @brief The type check only runs when the focused widget changes
+	 */
+	protected bool IsInputFocused()
+	{
+		Widget focusedWidget = GetFocus();
+		if ( focusedWidget != m_FocusedWidget )
+		{
+			m_FocusedWidget = focusedWidget;
+			m_IsInputFocused = focusedWidget && ( focusedWidget.IsInherited( EditBoxWidget ) || focusedWidget.IsInherited( MultilineEditBoxWidget ) );
+		}
+
+		return m_IsInputFocused;
+	}
+
+	protected void UpdateBindings()
+	{
+		if ( m_BindingsRevision != JMModuleBase.GetBindingsRevision() )
+			BuildBindingInputs();
+
+		if ( DISABLE_ALL_INPUT || IsInputFocused() )
+			return;
+
+		bool inMenu = IsPreventingModuleBindings() || GetGame().GetUIManager().GetMenu() != NULL;
+
+		for ( int i = 0; i < m_BindingInputs.Count(); i++ )
+		{
+			int count = m_BindingInputs[i].Poll();
+			if ( count > 0 )
+				m_BindingInputs[i].Dispatch( count, inMenu );
+		}
 	}
 
 	ref JMModuleBase GetModule( typename type )
@@ -42,6 +322,92 @@ class JMModuleManager: JMModuleManagerBase
 	protected void InitModule( ref JMModuleBase module )
 	{
 		module.Init();
+
+		if ( module.IsInitAsync() )
+		{
+			thread InitModuleAsync( module );
+			return;
+		}
+
+		module.InitAsync();
+
+		OnModuleInitialized( module );
+	}
+
+	protected void InitModuleAsync( JMModuleBase module )
+	{
+		module.InitAsync();
+
+		OnModuleInitialized( module );
+	}
+
+	protected bool CanInitModule( JMModuleBase module )
+	{
+		array< JMModuleBase > dependencies = m_Dependencies.Get( module );
+		if ( !dependencies )
+			return true;
+
+		for ( int i = 0; i < dependencies.Count(); i++ )
+		{
+			if ( !dependencies[i].IsInitialized() )
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Replays the events the module missed while it was initialising
+	 * and starts any module that was waiting on it.
+	 */
+	protected void OnModuleInitialized( JMModuleBase module )
+	{
+		module._SetInitialized();
+
+		if ( module.IsEnabled() )
+		{
+			if ( m_OnInitCalled )
+				module.OnInit();
+
+			if ( m_MissionStarted )
+				module.OnMissionStart();
+
+			if ( m_MissionLoaded )
+				module.OnMissionLoaded();
+		}
+
+		int i = 0;
+		while ( i < m_PendingInit.Count() )
+		{
+			JMModuleBase pending = m_PendingInit[i];
+			if ( !CanInitModule( pending ) )
+			{
+				i++;
+				continue;
+			}
+
+			m_PendingInit.RemoveOrdered( i );
+			InitModule( pending );
+
+			//! InitModule may have started other pending modules
+			i = 0;
+		}
+	}
+
+	/**
+	 * @brief Enabled and done initialising, only these modules receive events
+	 */
+	protected bool IsModuleActive( JMModuleBase module )
+	{
+		return module.IsEnabled() && module.IsInitialized();
+	}
+
+	/**
+	 * @brief Modules still waiting on an async dependency
+	 */
+	int GetPendingInitCount()
+	{
+		return m_PendingInit.Count();
 	}
 
 	override void InitModules()
@@ -50,16 +416,57 @@ class JMModuleManager: JMModuleManagerBase
 
 		//GetLogger().Log( "JMModuleManager::InitModules()", "JM_COT_ModuleFramework" );
 		
+		#ifdef CF_PROFILER
+		CF_Profiler.Begin( "JMModuleManager::InitModules" );
+		#endif
+
+		m_PendingInit = new array< JMModuleBase >;
+
+		if ( IsMissionHost() )
+			RegisterPlayerData();
+
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			InitModule( m_ModuleList[i] );
+			if ( CanInitModule( m_ModuleList[i] ) )
+			{
+				InitModule( m_ModuleList[i] );
+			} else
+			{
+				m_PendingInit.Insert( m_ModuleList[i] );
+			}
 		}
 
+		#ifdef CF_PROFILER
+		CF_Profiler.End();
+		#endif
+
 		Print_DumpModules();
 
+		m_OnInitCalled = true;
+
 		OnInit();
 	}
 
+	/**
+	 * @brief Runs before any module is initialised, so only IsEnabled is checked,
+	 * players can connect while an async module is still initialising
+	 */
+	protected void RegisterPlayerData()
+	{
+		array< typename > types = new array< typename >;
+		for ( int i = 0; i < m_ModuleList.Count(); i++ )
+		{
+			if ( !m_ModuleList[i].IsEnabled() )
+				continue;
+
+			types.Clear();
+			m_ModuleList[i].RegisterPlayerData( types );
+
+			for ( int j = 0; j < types.Count(); j++ )
+				CF.PlayerData.Register( types[j] );
+		}
+	}
+
 	override void OnSettingsUpdated()
 	{
 		super.OnSettingsUpdated();
@@ -68,7 +475,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnSettingsUpdated();
 			}
@@ -93,7 +500,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnInit();
 			}
@@ -106,13 +513,23 @@ class JMModuleManager: JMModuleManagerBase
 
 		//GetLogger().Log( "JMModuleManager::OnMissionStart()", "JM_COT_ModuleFramework" );
 
+		m_MissionStarted = true;
+
+		#ifdef CF_PROFILER
+		CF_Profiler.Begin( "JMModuleManager::OnMissionStart" );
+		#endif
+
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnMissionStart();
 			}
 		}
+
+		#ifdef CF_PROFILER
+		CF_Profiler.End();
+		#endif
 	}
 
 	override void OnMissionFinish()
@@ -123,7 +540,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnMissionFinish();
 			}
@@ -136,13 +553,23 @@ class JMModuleManager: JMModuleManagerBase
 
 		//GetLogger().Log( "JMModuleManager::OnMissionLoaded()", "JM_COT_ModuleFramework" );
 
+		m_MissionLoaded = true;
+
+		#ifdef CF_PROFILER
+		CF_Profiler.Begin( "JMModuleManager::OnMissionLoaded" );
+		#endif
+
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnMissionLoaded();
 			}
 		}
+
+		#ifdef CF_PROFILER
+		CF_Profiler.End();
+		#endif
 	}
 
 	override void OnRPC( PlayerIdentity sender, Object target, int rpc_type, ref ParamsReadContext ctx )
@@ -160,9 +587,17 @@ class JMModuleManager: JMModuleManagerBase
 			if ( max == -1 || rpc_type >= max )
 				continue;
 
-			if ( module.IsEnabled() )
+			if ( IsModuleActive( module ) )
 			{
+				#ifdef CF_PROFILER
+				CF_Profiler.Begin( "JMModuleManager::OnRPC" );
+				#endif
+
 				module.OnRPC( sender, target, rpc_type, ctx );
+
+				#ifdef CF_PROFILER
+				CF_Profiler.End();
+				#endif
 			}
 
 			return;
@@ -175,88 +610,41 @@ class JMModuleManager: JMModuleManagerBase
 		
 		//GetLogger().Log( "JMModuleManager::OnUpdate()", "JM_COT_ModuleFramework" );
 
-		bool inputIsFocused = false;
+		#ifdef CF_PROFILER
+		CF_Profiler.Begin( "JMModuleManager::OnUpdate" );
+		#endif
+
+		ProcessDeferredEvents();
 
 		if ( GetGame().IsClient() || !GetGame().IsMultiplayer() )
 		{
-			ref Widget focusedWidget = GetFocus();
-			if ( focusedWidget && focusedWidget.ClassName().Contains("EditBoxWidget") )
-			{
-				inputIsFocused = true;
-			}
+			UpdateBindings();
 		}
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
 			JMModuleBase module = m_ModuleList[i];
 
-			if ( module.IsEnabled() && !module.IsPreventingInput() && !inputIsFocused && !DISABLE_ALL_INPUT && ( GetGame().IsClient() || !GetGame().IsMultiplayer() ) )
-			{
-				for ( int kb = 0; kb < module.GetBindings().Count(); kb++ )
-				{
-					JMModuleBinding k_m_Binding = module.GetBindings().Get( kb );
-
-					if ( IsPreventingModuleBindings() || GetGame().GetUIManager().GetMenu() )
-					{
-						if ( !k_m_Binding.CanBeUsedInMenu() )
-						{
-							continue;
-						}
-					}
-
-					string inputName = k_m_Binding.GetUAInputName();
-
-					UAInput input = GetUApi().GetInputByName( inputName );
-
-					bool localPress = input.LocalPress();
-					bool localRelease = input.LocalRelease();
-					bool localHold = input.LocalHold();
-					bool localClick = input.LocalClick();
-					bool localDoubleClick = input.LocalDoubleClick();
-
-					bool canLocalPress = input.IsPressLimit();
-					bool canLocalRelease = input.IsReleaseLimit();
-					bool canLocalHold = input.IsHoldLimit();
-					bool canLocalClick = input.IsClickLimit();
-					bool canLocalDoubleClick = input.IsDoubleClickLimit();
+			//! Still in InitAsync
+			if ( !module.IsInitialized() )
+				continue;
 
-					bool isLimited = canLocalPress || canLocalRelease || canLocalHold || canLocalClick || canLocalDoubleClick;
+			#ifdef CF_PROFILER
+			if ( CF_Profiler.IsEnabled() )
+				CF_Profiler.Begin( module.GetModuleName() );
+			#endif
 
-					if ( isLimited )
-					{
-						if ( canLocalPress && localPress )
-						{
-							GetGame().GameScript.CallFunctionParams( module, k_m_Binding.GetCallBackFunction(), NULL, new Param1< UAInput >( input ) );
-						}
-						
-						if ( canLocalRelease && localRelease )
-						{
-							GetGame().GameScript.CallFunctionParams( module, k_m_Binding.GetCallBackFunction(), NULL, new Param1< UAInput >( input ) );
-						}
-
-						if ( canLocalHold && localHold )
-						{
-							GetGame().GameScript.CallFunctionParams( module, k_m_Binding.GetCallBackFunction(), NULL, new Param1< UAInput >( input ) );
-						}
-
-						if ( canLocalClick && localClick )
-						{
-							GetGame().GameScript.CallFunctionParams( module, k_m_Binding.GetCallBackFunction(), NULL, new Param1< UAInput >( input ) );
-						}
-
-						if ( canLocalDoubleClick && localDoubleClick )
-						{
-							GetGame().GameScript.CallFunctionParams( module, k_m_Binding.GetCallBackFunction(), NULL, new Param1< UAInput >( input ) );
-						}
-					} else
-					{
-						GetGame().GameScript.CallFunctionParams( module, k_m_Binding.GetCallBackFunction(), NULL, new Param1< UAInput >( input ) );
-					}
-				}
-			}
-			
 			module.OnUpdate( timeslice );
+
+			#ifdef CF_PROFILER
+			if ( CF_Profiler.IsEnabled() )
+				CF_Profiler.End();
+			#endif
 		}
+
+		#ifdef CF_PROFILER
+		CF_Profiler.End();
+		#endif
 	}
 
 	override void OnWorldCleanup()
@@ -265,7 +653,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnWorldCleanup();
 			}
@@ -278,7 +666,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnMPSessionStart();
 			}
@@ -291,7 +679,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnMPSessionPlayerReady();
 			}
@@ -304,7 +692,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnMPSessionFail();
 			}
@@ -317,7 +705,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnMPSessionEnd();
 			}
@@ -330,7 +718,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnMPConnectAbort();
 			}
@@ -343,7 +731,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnMPConnectionLost( duration );
 			}
@@ -356,7 +744,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnRespawn( time );
 			}
@@ -369,7 +757,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnClientLogoutCancelled( player, identity );
 			}
@@ -380,13 +768,23 @@ class JMModuleManager: JMModuleManagerBase
 	{
 		//GetLogger().Log( "JMModuleManager::OnClientNew()", "JM_COT_ModuleFramework" );
 
+		#ifdef CF_PROFILER
+		CF_Profiler.Begin( "JMModuleManager::OnInvokeConnect" );
+		#endif
+
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnInvokeConnect( player, identity );
 			}
 		}
+
+		QueueDeferredEvents( JMModuleDeferredEventType.InvokeConnect, player, identity );
+
+		#ifdef CF_PROFILER
+		CF_Profiler.End();
+		#endif
 	}
 
 	void OnInvokeDisconnect( PlayerBase player )
@@ -395,7 +793,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnInvokeDisconnect( player );
 			}
@@ -408,11 +806,13 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnClientNew( player, identity, pos, ctx );
 			}
 		}
+
+		QueueDeferredEvents( JMModuleDeferredEventType.ClientNew, player, identity );
 	}
 
 	void OnClientReady( PlayerBase player, PlayerIdentity identity )
@@ -421,20 +821,41 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnClientReady( player, identity );
 			}
 		}
+
+		CF_PlayerDataSet data;
+		if ( identity )
+			data = CF.PlayerData.Get( identity.GetId() );
+
+		if ( data )
+		{
+			for ( i = 0; i < m_ModuleList.Count(); i++ )
+			{
+				if ( IsModuleActive( m_ModuleList[i] ) )
+				{
+					m_ModuleList[i].OnClientReady( player, identity, data );
+				}
+			}
+		}
+
+		QueueDeferredEvents( JMModuleDeferredEventType.ClientReady, player, identity );
 	}
 
 	void OnClientPrepare( PlayerIdentity identity, out bool useDB, out vector pos, out float yaw, out int preloadTimeout )
 	{
 		//GetLogger().Log( "JMModuleManager::OnClientPrepare()", "JM_COT_ModuleFramework" );
 
+		//! Read while the client is still loading, OnClientReady gets the records
+		if ( identity )
+			CF.PlayerData.Preload( identity.GetId() );
+
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnClientPrepare( identity, useDB, pos, yaw, preloadTimeout );
 			}
@@ -447,11 +868,13 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnClientReconnect( player, identity );
 			}
 		}
+
+		QueueDeferredEvents( JMModuleDeferredEventType.ClientReconnect, player, identity );
 	}
 
 	void OnClientRespawn( PlayerBase player, PlayerIdentity identity )
@@ -460,11 +883,13 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnClientRespawn( player, identity );
 			}
 		}
+
+		QueueDeferredEvents( JMModuleDeferredEventType.ClientRespawn, player, identity );
 	}
 
 	void OnClientLogout( PlayerBase player, PlayerIdentity identity, int logoutTime, bool authFailed )
@@ -473,7 +898,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnClientLogout( player, identity, logoutTime, authFailed );
 			}
@@ -486,11 +911,15 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnClientDisconnect( player, identity, uid );
 			}
 		}
+
+		RemoveDeferredEvents( uid );
+
+		CF.PlayerData.OnDisconnect( uid );
 	}
 
 	void OnClientLogoutCancelled( PlayerBase player )
@@ -499,7 +928,7 @@ class JMModuleManager: JMModuleManagerBase
 
 		for ( int i = 0; i < m_ModuleList.Count(); i++ )
 		{
-			if ( m_ModuleList[i].IsEnabled() )
+			if ( IsModuleActive( m_ModuleList[i] ) )
 			{
 				m_ModuleList[i].OnClientLogoutCancelled( player );
 			}
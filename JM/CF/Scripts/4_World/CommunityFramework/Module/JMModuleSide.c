@@ -0,0 +1,9 @@
+/**
+ * @brief Sides a module is constructed on, declared when the module is registered
+ */
+enum JMModuleSide
+{
+	Client = 1,
+	Server = 2,
+	Both = 3
+}
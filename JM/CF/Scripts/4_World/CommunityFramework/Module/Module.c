@@ -0,0 +1,38 @@
+/**
+ * @brief Typed access to a module without a map lookup or a cast.
+ *
+ * The instance is cached in a static field per module type and is looked up
+ * again only after the module manager has been recreated.
+ *
+ * @code
+ * MyModule module = CF_Module< MyModule >.Get();
+ * @endcode
+ */
+class CF_Module< Class T >
+{
+	protected static T s_Instance;
+	protected static int s_Generation = -1;
+
+	//!Single static instance. Do not create with new or spawn - use CF_Module<T>.Get() instead.
+	protected void CF_Module();
+	protected void ~CF_Module();
+
+	/**
+	 * @brief Returns the module, NULL if it isn't loaded on this side or the
+	 * module manager doesn't exist yet
+	 */
+	static T Get()
+	{
+		if ( s_Generation == JMModuleManagerBase.GetGeneration() )
+			return s_Instance;
+
+		JMModuleManager manager = GetModuleManager();
+		if ( !manager )
+			return NULL;
+
+		Class.CastTo( s_Instance, manager.GetModule( T ) );
+		s_Generation = JMModuleManagerBase.GetGeneration();
+
+		return s_Instance;
+	}
+};
@@ -15,4 +15,9 @@ modded class MissionBase
 			Print( "Ignoring creation of ModuleManager" );
 		}
 	}
+
+	void ~MissionBase()
+	{
+		ScriptViewPreloader.Clear();
+	}
 };
\ No newline at end of file
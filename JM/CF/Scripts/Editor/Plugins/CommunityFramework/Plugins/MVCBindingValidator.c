@@ -0,0 +1,559 @@
+// Widget of a .layout file, only what the validator needs
+class MVCLayoutNode
+{
+	string Name;
+	string ScriptClass;
+
+	ref map<string, string> Params = new map<string, string>();
+	ref array<ref MVCLayoutNode> Children = new array<ref MVCLayoutNode>();
+
+	void MVCLayoutNode(string name)
+	{
+		Name = name;
+	}
+
+	typename GetScriptType()
+	{
+		return ScriptClass.ToType();
+	}
+
+	bool IsController()
+	{
+		typename type = GetScriptType();
+		return type && type.IsInherited(Controller);
+	}
+
+	bool IsViewBinding()
+	{
+		typename type = GetScriptType();
+		return type && type.IsInherited(ViewBinding);
+	}
+
+	void CountNames(map<string, int> names)
+	{
+		names.Set(Name, names.Get(Name) + 1);
+
+		foreach (MVCLayoutNode child : Children)
+		{
+			child.CountNames(names);
+		}
+	}
+};
+
+// Reads the widget tree of a .layout file
+class MVCLayoutParser
+{
+	static const int BLOCK_WIDGET = 0;
+	static const int BLOCK_CHILDREN = 1;
+	static const int BLOCK_PARAMS = 2;
+	static const int BLOCK_OTHER = 3;
+
+	static MVCLayoutNode Parse(string path)
+	{
+		FileHandle handle = OpenFile(path, FileMode.READ);
+		if (handle == 0)
+			return null;
+
+		MVCLayoutNode root;
+
+		// Open blocks and the widget each belongs to
+		array<int> blocks = {};
+		array<MVCLayoutNode> owners = {};
+
+		string line;
+		while (FGets(handle, line) >= 0)
+		{
+			line = line.Trim();
+			if (line == string.Empty)
+				continue;
+
+			MVCLayoutNode current;
+			if (owners.Count() > 0)
+			{
+				current = owners[owners.Count() - 1];
+			}
+
+			if (line == "}")
+			{
+				if (blocks.Count() > 0)
+				{
+					blocks.Remove(blocks.Count() - 1);
+					owners.Remove(owners.Count() - 1);
+				}
+
+				continue;
+			}
+
+			if (line == "{")
+			{
+				blocks.Insert(BLOCK_CHILDREN);
+				owners.Insert(current);
+				continue;
+			}
+
+			string key;
+			string value;
+			SplitLine(line, key, value);
+
+			if (line.IndexOf("{") == line.Length() - 1)
+			{
+				if (key == "ScriptParamsClass")
+				{
+					blocks.Insert(BLOCK_PARAMS);
+					owners.Insert(current);
+				} else if (key.IndexOf("WidgetClass") != -1)
+				{
+					value.Replace("{", "");
+					MVCLayoutNode node = new MVCLayoutNode(Unquote(value.Trim()));
+					if (current)
+					{
+						current.Children.Insert(node);
+					} else if (!root)
+					{
+						root = node;
+					}
+
+					blocks.Insert(BLOCK_WIDGET);
+					owners.Insert(node);
+				} else
+				{
+					blocks.Insert(BLOCK_OTHER);
+					owners.Insert(current);
+				}
+
+				continue;
+			}
+
+			if (!current || blocks.Count() == 0)
+				continue;
+
+			int block = blocks[blocks.Count() - 1];
+			if (block == BLOCK_PARAMS)
+			{
+				current.Params.Set(key, Unquote(value));
+			} else if (block == BLOCK_WIDGET && key == "scriptclass")
+			{
+				current.ScriptClass = Unquote(value);
+			}
+		}
+
+		CloseFile(handle);
+		return root;
+	}
+
+	protected static void SplitLine(string line, out string key, out string value)
+	{
+		int split = line.IndexOf(" ");
+
+		// "no focus" 1
+		if (line.IndexOf("\"") == 0)
+		{
+			split = line.IndexOfFrom(1, "\"") + 1;
+		}
+
+		if (split <= 0)
+		{
+			key = line;
+			value = string.Empty;
+			return;
+		}
+
+		key = Unquote(line.Substring(0, split));
+		value = line.Substring(split, line.Length() - split).Trim();
+	}
+
+	protected static string Unquote(string value)
+	{
+		value = value.Trim();
+		if (value.Length() >= 2 && value.IndexOf("\"") == 0 && value.LastIndexOf("\"") == value.Length() - 1)
+		{
+			return value.Substring(1, value.Length() - 2);
+		}
+
+		return value;
+	}
+};
+
+[WorkbenchPluginAttribute("Validate MVC Bindings", "Checks ViewBindings of all layouts against their Controllers and writes binding manifests", "", "", {"ResourceManager", "ScriptEditor"})]
+class MVCBindingValidatorPlugin: WorkbenchPlugin
+{
+	[Attribute("", "editbox", "Only check layouts whose path starts with this, i.e. MyMod/GUI")]
+	string Path_Filter;
+
+	[Attribute("1", "checkbox", "Write <layout>.bindings next to each layout")]
+	bool Write_Manifests;
+
+	protected ref TStringArray m_Layouts;
+	protected ref TStringArray m_Scripts;
+
+	// 0: Layout file, lowercase with forward slashes
+	// 1: Controller type a ScriptView creates in script for the layout
+	protected ref map<string, string> m_ScriptControllers;
+
+	protected int m_Errors;
+	protected int m_Manifests;
+
+	override void Run()
+	{
+		Workbench.ScriptDialog("Validate MVC Bindings", "", this);
+	}
+
+	[ButtonAttribute("Validate")]
+	void DialogOk()
+	{
+		m_Layouts = {};
+		m_Scripts = {};
+		m_ScriptControllers = new map<string, string>();
+		m_Errors = 0;
+		m_Manifests = 0;
+
+		Workbench.SearchResources("c", OnScriptFound);
+		foreach (string script : m_Scripts)
+		{
+			ReadScriptViews(script);
+		}
+
+		Workbench.SearchResources("layout", OnLayoutFound);
+
+		foreach (string layout : m_Layouts)
+		{
+			ValidateLayout(layout);
+		}
+
+		ViewBindingManifest.Clear();
+
+		string summary = string.Format("%1 layouts checked, %2 problems found, %3 manifests written\nSee the console for details", m_Layouts.Count(), m_Errors, m_Manifests);
+		Workbench.Dialog("Validate MVC Bindings", summary);
+	}
+
+	[ButtonAttribute("Cancel")]
+	void DialogCancel()
+	{
+	}
+
+	protected void OnLayoutFound(string file)
+	{
+		file.Replace("\\", "/");
+		if (Path_Filter != string.Empty && file.IndexOf(Path_Filter) != 0)
+			return;
+
+		m_Layouts.Insert(file);
+	}
+
+	protected void OnScriptFound(string file)
+	{
+		m_Scripts.Insert(file);
+	}
+
+	// Finds ScriptViews that create their Controller in script, GetLayoutFile and
+	// GetControllerType are read from their return statements so only literals are found
+	protected void ReadScriptViews(string script)
+	{
+		string absolute;
+		if (!Workbench.GetAbsolutePath(script, absolute))
+			return;
+
+		FileHandle handle = OpenFile(absolute, FileMode.READ);
+		if (handle == 0)
+			return;
+
+		string viewType;
+		string layout;
+		string controllerType;
+		string method;
+
+		string line;
+		while (FGets(handle, line) >= 0)
+		{
+			line = line.Trim();
+
+			if (line.IndexOf("class ") == 0)
+			{
+				AddScriptView(viewType, layout, controllerType);
+
+				viewType = GetClassName(line);
+				layout = string.Empty;
+				controllerType = string.Empty;
+				method = string.Empty;
+
+				int template = line.IndexOf("ScriptViewTemplate<");
+				if (template != -1)
+				{
+					int start = template + "ScriptViewTemplate<".Length();
+					int end = line.IndexOfFrom(start, ">");
+					if (end != -1)
+					{
+						controllerType = line.Substring(start, end - start).Trim();
+					}
+				}
+
+				continue;
+			}
+
+			if (line.Contains("string GetLayoutFile("))
+			{
+				method = "layout";
+			} else if (line.Contains("typename GetControllerType("))
+			{
+				method = "controller";
+			}
+
+			int ret = line.IndexOf("return ");
+			if (method == string.Empty || ret == -1)
+				continue;
+
+			string value = line.Substring(ret + 7, line.Length() - ret - 7);
+			value.Replace(";", "");
+			value.Replace("}", "");
+			value.Replace("\"", "");
+			value = value.Trim();
+
+			if (method == "layout")
+			{
+				layout = value;
+			} else
+			{
+				controllerType = value;
+			}
+
+			method = string.Empty;
+		}
+
+		AddScriptView(viewType, layout, controllerType);
+
+		CloseFile(handle);
+	}
+
+	protected void AddScriptView(string viewType, string layout, string controllerType)
+	{
+		if (layout == string.Empty || controllerType == string.Empty)
+			return;
+
+		typename type = viewType.ToType();
+		typename controller = controllerType.ToType();
+		if (!type || !type.IsInherited(ScriptView) || !controller || !controller.IsInherited(Controller))
+			return;
+
+		m_ScriptControllers.Set(NormalizePath(layout), controllerType);
+	}
+
+	protected string GetClassName(string line)
+	{
+		string name = line.Substring(6, line.Length() - 6).Trim();
+		for (int i = 0; i < name.Length(); i++)
+		{
+			string c = name.Get(i);
+			if (c == " " || c == ":" || c == "<" || c == "{")
+				return name.Substring(0, i);
+		}
+
+		return name;
+	}
+
+	protected string NormalizePath(string path)
+	{
+		path.Replace("\\", "/");
+		path.ToLower();
+		return path;
+	}
+
+	protected void ValidateLayout(string layout)
+	{
+		string absolute;
+		if (!Workbench.GetAbsolutePath(layout, absolute))
+			return;
+
+		MVCLayoutNode root = MVCLayoutParser.Parse(absolute);
+		if (!root)
+			return;
+
+		array<ref ViewBindingManifestScope> scopes = new array<ref ViewBindingManifestScope>();
+
+		// A Controller on the layout root wins over the one the ScriptView would create
+		string scriptController = m_ScriptControllers.Get(NormalizePath(layout));
+		if (scriptController != string.Empty && !root.IsController())
+		{
+			ValidateController(layout, root, scriptController.ToType(), scopes);
+		} else
+		{
+			ValidateNode(layout, root, null, scopes);
+		}
+
+		if (!Write_Manifests)
+			return;
+
+		if (scopes.Count() == 0)
+		{
+			// Stale manifests would make the runtime skip the widget walk for nothing
+			if (FileExist(absolute + ViewBindingManifest.EXTENSION))
+				DeleteFile(absolute + ViewBindingManifest.EXTENSION);
+
+			return;
+		}
+
+		if (ViewBindingManifest.Write(absolute, scopes))
+		{
+			m_Manifests++;
+		}
+	}
+
+	// Walks the tree, every Controller validates the bindings in its own scope
+	protected void ValidateNode(string layout, MVCLayoutNode node, MVCLayoutNode controller, array<ref ViewBindingManifestScope> scopes)
+	{
+		if (node.IsController())
+		{
+			ValidateController(layout, node, node.GetScriptType(), scopes);
+			return;
+		}
+
+		// Controllers created in code without a ScriptView can't be found, so this is only a notice
+		if (node.IsViewBinding() && !controller)
+		{
+			Print(string.Format("[MVC] %1: %2 not validated, no Controller in the layout or in a ScriptView using it", layout, node.Name));
+		}
+
+		foreach (MVCLayoutNode child : node.Children)
+		{
+			ValidateNode(layout, child, controller, scopes);
+		}
+	}
+
+	protected void ValidateController(string layout, MVCLayoutNode controller, typename controllerType, array<ref ViewBindingManifestScope> scopes)
+	{
+		ViewBindingManifestScope scope = new ViewBindingManifestScope(controllerType.ToString(), controller.Name);
+
+		CollectScope(layout, controller, controllerType, controller, scope, scopes, new array<int>());
+
+		// The runtime finds widgets by name, so the manifest needs unique names
+		map<string, int> names = new map<string, int>();
+		controller.CountNames(names);
+
+		foreach (ViewPropertyPath binding : scope.Bindings)
+		{
+			if (names.Get(binding.Name) > 1)
+			{
+				Print(string.Format("[MVC] %1: %2 is not unique under %3, no manifest for this Controller", layout, binding.Name, controller.Name));
+				return;
+			}
+		}
+
+		foreach (ViewPropertyPath child : scope.Controllers)
+		{
+			if (names.Get(child.Name) > 1)
+			{
+				Print(string.Format("[MVC] %1: %2 is not unique under %3, no manifest for this Controller", layout, child.Name, controller.Name));
+				return;
+			}
+		}
+
+		scopes.Insert(scope);
+	}
+
+	// Same traversal as Controller.LoadDataBindings, stops at child Controllers
+	// path is the child indices from the Controller root down to node
+	protected void CollectScope(string layout, MVCLayoutNode node, typename controllerType, MVCLayoutNode controller, ViewBindingManifestScope scope, array<ref ViewBindingManifestScope> scopes, array<int> path)
+	{
+		foreach (int index, MVCLayoutNode child : node.Children)
+		{
+			array<int> childPath = {};
+			childPath.Copy(path);
+			childPath.Insert(index);
+
+			if (child.IsController())
+			{
+				scope.Controllers.Insert(CreateEntry(child.Name, childPath));
+				ValidateController(layout, child, child.GetScriptType(), scopes);
+				continue;
+			}
+
+			if (child.IsViewBinding())
+			{
+				scope.Bindings.Insert(CreateEntry(child.Name, childPath));
+				ValidateBinding(layout, child, controllerType);
+			}
+
+			CollectScope(layout, child, controllerType, controller, scope, scopes, childPath);
+		}
+	}
+
+	protected ViewPropertyPath CreateEntry(string name, array<int> path)
+	{
+		ViewPropertyPath entry = new ViewPropertyPath(name);
+		entry.Path.Copy(path);
+		return entry;
+	}
+
+	protected void ValidateBinding(string layout, MVCLayoutNode binding, typename controllerType)
+	{
+		string bindingName = binding.Params.Get("Binding_Name");
+		if (bindingName != string.Empty)
+		{
+			ValidateProperty(layout, binding, controllerType, "Binding_Name", bindingName);
+		}
+
+		string selectedItem = binding.Params.Get("Selected_Item");
+		if (selectedItem != string.Empty)
+		{
+			ValidateProperty(layout, binding, controllerType, "Selected_Item", selectedItem);
+		}
+
+		string relayCommand = binding.Params.Get("Relay_Command");
+		if (relayCommand != string.Empty)
+		{
+			typename commandType = ResolveProperty(controllerType, relayCommand);
+			if (!commandType)
+			{
+				commandType = relayCommand.ToType();
+			}
+
+			// Methods can't be listed through reflection, so anything else is assumed to be one
+			if (!commandType || !commandType.IsInherited(RelayCommand))
+			{
+				Print(string.Format("[MVC] %1: %2 Relay_Command %3 is not a RelayCommand, assuming a method on %4", layout, binding.Name, relayCommand, controllerType.ToString()));
+			}
+		}
+	}
+
+	protected void ValidateProperty(string layout, MVCLayoutNode binding, typename controllerType, string param, string propertyName)
+	{
+		typename propertyType = ResolveProperty(controllerType, propertyName);
+		if (!propertyType)
+		{
+			Report(layout, binding, string.Format("%1 %2 not found on %3", param, propertyName, controllerType.ToString()));
+			return;
+		}
+
+		if (!LayoutBindingManager.HasTypeConversion(propertyType))
+		{
+			Report(layout, binding, string.Format("%1 %2 has type %3 without a TypeConverter", param, propertyName, propertyType.ToString()));
+		}
+	}
+
+	// Follows dotted names, i.e. m_Binding.Value
+	protected typename ResolveProperty(typename type, string propertyName)
+	{
+		TStringArray scopes = {};
+		propertyName.Split(".", scopes);
+
+		typename result;
+		foreach (string scopeName : scopes)
+		{
+			if (!type)
+			{
+				typename empty;
+				return empty;
+			}
+
+			result = PropertyTypeHashMap.GetCached(type).Get(scopeName);
+			type = result;
+		}
+
+		return result;
+	}
+
+	protected void Report(string layout, MVCLayoutNode node, string message)
+	{
+		m_Errors++;
+		Print(string.Format("[MVC] Error %1: %2 %3", layout, node.Name, message));
+	}
+};
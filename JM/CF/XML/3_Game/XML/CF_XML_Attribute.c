@@ -2,39 +2,75 @@ typedef CF_XML_Attribute XMLAttribute;
 
 class CF_XML_Attribute : Managed
 {
-	private string _name;
+	private static const int CACHED_BOOL = 1;
+	private static const int CACHED_INT = 2;
+	private static const int CACHED_FLOAT = 4;
+	private static const int CACHED_VECTOR = 8;
+
+	private int _nameId;
 	private string _value;
 
+	//! Typed values are parsed on first request and kept until the value changes
+	private int _cached;
+	private bool _bool;
+	private int _int;
+	private float _float;
+	private vector _vector;
+
 	private CF_XML_Tag _parentTag;
 
 	void CF_XML_Attribute(ref CF_XML_Tag parent, string name)
 	{
 		_parentTag = parent;
-		_name = name;
+		_nameId = CF_StringPool.Intern(name);
 		_value = "";
 	}
 
 	ref CF_XML_Attribute Copy(ref CF_XML_Tag parent = NULL)
 	{
-		ref CF_XML_Attribute element = new CF_XML_Attribute(parent, _name);
+		ref CF_XML_Attribute element = new CF_XML_Attribute(parent, "");
 
+		element._nameId = _nameId;
 		element._value = _value;
 
+		element._cached = _cached;
+		element._bool = _bool;
+		element._int = _int;
+		element._float = _float;
+		element._vector = _vector;
+
 		return element;
 	}
 
 	string GetName()
 	{
-		return _name;
+		return CF_StringPool.Get(_nameId);
+	}
+
+	int GetNameId()
+	{
+		return _nameId;
+	}
+
+	//! Attributes belong to one tag, the tag is detached from its copies instead
+	private void Detach()
+	{
+		if (_parentTag)
+			_parentTag._Detach();
 	}
 
 	void SetValue(string value)
 	{
+		Detach();
+
 		_value = value;
+		_cached = 0;
 	}
 
 	void SetValue(bool value)
 	{
+		Detach();
+
 		if (value)
 		{
 			_value = "true";
@@ -43,21 +79,39 @@ class CF_XML_Attribute : Managed
 		{
 			_value = "false";
 		}
+
+		_bool = value;
+		_cached = CACHED_BOOL;
 	}
 
 	void SetValue(int value)
 	{
+		Detach();
+
 		_value = "" + value;
+
+		_int = value;
+		_cached = CACHED_INT;
 	}
 
 	void SetValue(float value)
 	{
+		Detach();
+
 		_value = "" + value;
+
+		_float = value;
+		_cached = CACHED_FLOAT;
 	}
 
 	void SetValue(vector value)
 	{
+		Detach();
+
 		_value = "" + value[0] + " " + value[1] + " " + value[2];
+
+		_vector = value;
+		_cached = CACHED_VECTOR;
 	}
 
 	string GetValue()
@@ -72,28 +126,46 @@ class CF_XML_Attribute : Managed
 
 	bool ValueAsBool()
 	{
-		if (_value == "true")
-			return true;
+		if ((_cached & CACHED_BOOL) == 0)
+		{
+			_bool = _value == "true";
+			_cached |= CACHED_BOOL;
+		}
 
-		return false;
+		return _bool;
 	}
 
 	int ValueAsInt()
 	{
-		return _value.ToInt();
+		if ((_cached & CACHED_INT) == 0)
+		{
+			_int = _value.ToInt();
+			_cached |= CACHED_INT;
+		}
+
+		return _int;
 	}
 
 	float ValueAsFloat()
 	{
-		return _value.ToFloat();
+		if ((_cached & CACHED_FLOAT) == 0)
+		{
+			_float = _value.ToFloat();
+			_cached |= CACHED_FLOAT;
+		}
+
+		return _float;
 	}
 
 	vector ValueAsVector()
 	{
-		array<string> tokens = new array<string>;
-		_value.Split(" ", tokens);
+		if ((_cached & CACHED_VECTOR) == 0)
+		{
+			_vector = _value.ToVector();
+			_cached |= CACHED_VECTOR;
+		}
 
-		return Vector(tokens[0].ToFloat(), tokens[1].ToFloat(), tokens[2].ToFloat());
+		return _vector;
 	}
 
 	CF_XML_Tag GetParent()
@@ -104,12 +176,12 @@ class CF_XML_Attribute : Managed
 	void Debug(int level = 0)
 	{
 		string indent = CF_Indent(level);
-		Print(indent + " name=" + _name + " value=" + _value);
+		Print(indent + " name=" + GetName() + " value=" + _value);
 	}
 
 	void OnWrite(FileHandle handle, int depth)
 	{
-		FPrint(handle, _name);
+		FPrint(handle, GetName());
 		FPrint(handle, "=\"");
 		FPrint(handle, _value);
 		FPrint(handle, "\" ");
@@ -20,14 +20,16 @@ class CF_XML_Document : CF_XML_Element
 		return _currentTag;
 	}
 
+	/**
+	 * @brief Copy on write, the copy shares every tag with this document. A
+	 * write to either document copies the path from the root to the changed
+	 * tag, tags read through the copy are copied without their children.
+	 */
 	ref CF_XML_Document CopyDocument()
 	{
 		ref CF_XML_Document document = new CF_XML_Document(NULL);
 
-		for (int i = 0; i < _tags.Count(); ++i)
-		{
-			document._tags.Insert(_tags[i].Copy(this));
-		}
+		document._CopyFrom(this);
 
 		return document;
 	}
@@ -147,16 +149,28 @@ class CF_XML_Document : CF_XML_Element
 	{
 		_reader = reader;
 
+		#ifdef CF_PROFILER
+		CF_Profiler.Begin("CF_XML_Document::Read");
+		#endif
+
 		while (!_reader.EOF())
 		{
 			if (!ReadTag())
 			{
 				delete _reader;
+
+				#ifdef CF_PROFILER
+				CF_Profiler.End();
+				#endif
 				return false;
 			}
 		}
 
 		delete _reader;
+
+		#ifdef CF_PROFILER
+		CF_Profiler.End();
+		#endif
 		return true;
 	}
 
@@ -16,30 +16,64 @@ class CF_XML_Element : Managed
 
 	void ~CF_XML_Element()
 	{
+		//! Shared tags stay alive for the other copies
 		for (int i = 0; i < _tags.Count(); ++i)
 		{
-			delete _tags[i];
+			_tags[i]._Release(this);
 		}
-
-		delete _tags;
 	}
 
+	/**
+	 * @brief Shallow copy, the tags are shared with this element until either
+	 * side modifies them
+	 */
 	ref CF_XML_Element Copy(ref CF_XML_Tag parent = NULL)
 	{
 		ref CF_XML_Element element = new CF_XML_Element(parent);
 
-		for (int i = 0; i < _tags.Count(); ++i)
+		element._CopyFrom(this);
+
+		return element;
+	}
+
+	/**
+	 * @brief [Internal] Shares the tags of the other element
+	 */
+	void _CopyFrom(CF_XML_Element other)
+	{
+		for (int i = 0; i < other._tags.Count(); ++i)
 		{
-			element._tags.Insert(_tags[i].Copy(element));
+			other._tags[i]._Share(this);
+			_tags.Insert(other._tags[i]);
 		}
 
-		element._data = "" + _data;
+		_data = other._data;
+	}
 
-		return element;
+	/**
+	 * @brief [Internal] Makes the tag above this element private to this
+	 * document before the element is modified
+	 */
+	void _Detach()
+	{
+		if (_parentTag)
+			_parentTag._Detach();
+	}
+
+	/**
+	 * @brief [Internal] Swaps a shared tag for the private copy of this element
+	 */
+	void _Replace(CF_XML_Tag tag, CF_XML_Tag copy)
+	{
+		int index = _tags.Find(tag);
+		if (index >= 0)
+			_tags[index] = copy;
 	}
 
 	ref CF_XML_Tag CreateTag(string name)
 	{
+		_Detach();
+
 		ref CF_XML_Tag tag = new CF_XML_Tag(this, name);
 
 		_tags.Insert(tag);
@@ -52,27 +86,57 @@ class CF_XML_Element : Managed
 		return _tags.Count();
 	}
 
+	/**
+	 * @brief A tag shared from the document this one was copied from is
+	 * replaced with a shallow copy first, so writes through the returned tag
+	 * only change this document. The children of the copy are still shared.
+	 */
 	ref CF_XML_Tag Get(int index)
 	{
-		return _tags[index];
+		CF_XML_Tag tag = _tags[index];
+		if (tag.GetParent() == this)
+			return tag;
+
+		CF_XML_Tag copy = tag.Copy(this);
+
+		tag._Release(this);
+		_tags[index] = copy;
+
+		return copy;
 	}
 
 	void Remove(ref CF_XML_Tag tag)
 	{
+		_Detach();
+
 		int index = _tags.Find(tag);
 		if (index >= 0)
-			_tags.Remove(index);
+		{
+			tag._Release(this);
+			_tags.RemoveOrdered(index);
+		}
 	}
 
 	array<CF_XML_Tag> Get(string type)
+	{
+		return Find(CF_StringPool.Find(type));
+	}
+
+	/**
+	 * @brief Lookup by interned name, see CF_StringPool
+	 */
+	array<CF_XML_Tag> Find(int typeId)
 	{
 		array<CF_XML_Tag> tags = new array<CF_XML_Tag>;
 
+		if (typeId == CF_StringPool.INVALID)
+			return tags;
+
 		for (int i = 0; i < _tags.Count(); ++i)
 		{
-			if (_tags[i].GetName() == type)
+			if (_tags[i].GetNameId() == typeId)
 			{
-				tags.Insert(_tags[i]);
+				tags.Insert(Get(i));
 			}
 		}
 
@@ -81,6 +145,8 @@ class CF_XML_Element : Managed
 
 	void SetContent(string data)
 	{
+		_Detach();
+
 		_data = data;
 	}
 
@@ -2,54 +2,119 @@ typedef CF_XML_Tag XMLTag;
 
 class CF_XML_Tag : Managed
 {
-	private string _name;
+	private int _nameId;
 	
-	private autoptr map<string, ref CF_XML_Attribute> _attributes;
+	private autoptr map<int, ref CF_XML_Attribute> _attributes;
 	
 	private ref CF_XML_Element _element;
 	
 	private CF_XML_Element _parentElement;
 
+	//! Elements of other copies which hold this tag as well as the parent
+	private autoptr array<CF_XML_Element> _sharedWith;
+
 	void CF_XML_Tag(ref CF_XML_Element parent, string name, bool isCopy = false)
 	{
-		_attributes = new map<string, ref CF_XML_Attribute>;
+		_attributes = new map<int, ref CF_XML_Attribute>;
+		_sharedWith = new array<CF_XML_Element>;
 		_parentElement = parent;
-		_name = name;
+		_nameId = CF_StringPool.Intern(name);
 
 		if (!isCopy)
 			_element = new CF_XML_Element(this);
 	}
 
-	void ~CF_XML_Tag()
+	/**
+	 * @brief Shallow copy, the attributes are copied and the child tags are
+	 * shared until either side modifies them
+	 */
+	ref CF_XML_Tag Copy(ref CF_XML_Element parent = NULL)
 	{
+		ref CF_XML_Tag tag = new CF_XML_Tag(parent, "", true);
+		tag._nameId = _nameId;
+
 		for (int i = 0; i < _attributes.Count(); ++i)
 		{
-			delete _attributes.GetElement(i);
+			ref CF_XML_Attribute attrib = _attributes.GetElement(i).Copy(tag);
+			tag._attributes.Insert(attrib.GetNameId(), attrib);
 		}
 
-		delete _attributes;
+		tag._element = _element.Copy(tag);
 
-		delete _element;
+		return tag;
 	}
 
-	ref CF_XML_Tag Copy(ref CF_XML_Element parent = NULL)
+	/**
+	 * @brief True if a copy of the document still holds this tag
+	 */
+	bool IsShared()
 	{
-		ref CF_XML_Tag tag = new CF_XML_Tag(parent, _name);
+		for (int i = 0; i < _sharedWith.Count(); ++i)
+		{
+			if (_sharedWith[i])
+				return true;
+		}
 
-		for (int i = 0; i < _attributes.Count(); ++i)
+		return false;
+	}
+
+	/**
+	 * @brief [Internal] Another element now holds this tag
+	 */
+	void _Share(CF_XML_Element element)
+	{
+		_sharedWith.Insert(element);
+	}
+
+	/**
+	 * @brief [Internal] An element stopped holding this tag, if it was the
+	 * parent one of the copies takes over
+	 */
+	void _Release(CF_XML_Element element)
+	{
+		if (element != _parentElement)
 		{
-			ref CF_XML_Attribute attrib = _attributes.GetElement(i).Copy(tag);
-			tag._attributes.Insert(attrib.GetName(), attrib);
+			_sharedWith.RemoveItem(element);
+			return;
 		}
 
-		tag._element = _element.Copy(tag);
+		_parentElement = NULL;
 
-		return tag;
+		while (_sharedWith.Count() > 0 && !_parentElement)
+		{
+			_parentElement = _sharedWith[0];
+			_sharedWith.RemoveOrdered(0);
+		}
+	}
+
+	/**
+	 * @brief [Internal] Called before this tag is modified. The path above is
+	 * made private first, then every copy still sharing this tag is given its
+	 * own shallow copy, so the write only lands in this document.
+	 */
+	void _Detach()
+	{
+		if (_parentElement)
+			_parentElement._Detach();
+
+		for (int i = 0; i < _sharedWith.Count(); ++i)
+		{
+			CF_XML_Element element = _sharedWith[i];
+			if (element)
+				element._Replace(this, Copy(element));
+		}
+
+		_sharedWith.Clear();
 	}
 
 	string GetName()
 	{
-		return _name;
+		return CF_StringPool.Get(_nameId);
+	}
+
+	int GetNameId()
+	{
+		return _nameId;
 	}
 
 	ref CF_XML_Tag CreateTag(string name)
@@ -64,16 +129,85 @@ class CF_XML_Tag : Managed
 
 	ref CF_XML_Attribute CreateAttribute(string name)
 	{
+		_Detach();
+
 		CF_XML_Attribute attrb = new CF_XML_Attribute(this, name);
 
-		_attributes.Insert(name, attrb);
+		_attributes.Insert(attrb.GetNameId(), attrb);
 
 		return attrb;
 	}
 
 	ref CF_XML_Attribute GetAttribute(string name)
 	{
-		return _attributes.Get(name);
+		return FindAttribute(CF_StringPool.Find(name));
+	}
+
+	/**
+	 * @brief Lookup by interned name, see CF_StringPool
+	 */
+	ref CF_XML_Attribute FindAttribute(int nameId)
+	{
+		if (nameId == CF_StringPool.INVALID)
+			return null;
+
+		return _attributes.Get(nameId);
+	}
+
+	int GetAttributeCount()
+	{
+		return _attributes.Count();
+	}
+
+	CF_XML_Attribute GetAttributeAt(int index)
+	{
+		return _attributes.GetElement(index);
+	}
+
+	/**
+	 * @brief Writes every attribute into the member variable of the target with
+	 * the same name, case insensitive, using the cached typed values.
+	 *
+	 * @return int		the number of attributes that matched a member
+	 */
+	int ReadAttributes(Class target)
+	{
+		CF_TypeInfo info = CF_TypeInfo.Get(target.Type());
+
+		int count = 0;
+		for (int i = 0; i < _attributes.Count(); ++i)
+		{
+			CF_XML_Attribute attrib = _attributes.GetElement(i);
+
+			CF_FieldInfo field = info.FindFieldByNameId(attrib.GetNameId());
+			if (!field)
+				continue;
+
+			switch (field.Kind)
+			{
+			case CF_FieldKind.BOOL:
+				EnScript.SetClassVar(target, field.Name, 0, attrib.ValueAsBool());
+				break;
+			case CF_FieldKind.INT:
+				EnScript.SetClassVar(target, field.Name, 0, attrib.ValueAsInt());
+				break;
+			case CF_FieldKind.FLOAT:
+				EnScript.SetClassVar(target, field.Name, 0, attrib.ValueAsFloat());
+				break;
+			case CF_FieldKind.STRING:
+				EnScript.SetClassVar(target, field.Name, 0, attrib.ValueAsString());
+				break;
+			case CF_FieldKind.VECTOR:
+				EnScript.SetClassVar(target, field.Name, 0, attrib.ValueAsVector());
+				break;
+			default:
+				continue;
+			}
+
+			count++;
+		}
+
+		return count;
 	}
 
 	CF_XML_Element GetContent()
@@ -91,7 +225,7 @@ class CF_XML_Tag : Managed
 		string indent = CF_Indent(level);
 
 		Print(indent + "Tag:");
-		Print(indent + " name=" + _name);
+		Print(indent + " name=" + GetName());
 
 		Print(indent + "Attributes: count=" + _attributes.Count());
 		for (int i = 0; i < _attributes.Count(); ++i)
@@ -109,7 +243,7 @@ class CF_XML_Tag : Managed
 
 		FPrint(handle, indent);
 		FPrint(handle, "<");
-		FPrint(handle, _name);
+		FPrint(handle, GetName());
 
 		if (_attributes.Count() > 0)
 		{
@@ -129,7 +263,7 @@ class CF_XML_Tag : Managed
 
 			FPrint(handle, indent);
 			FPrint(handle, "<");
-			FPrint(handle, _name);
+			FPrint(handle, GetName());
 			FPrint(handle, " ");
 		}
 		else if (_attributes.Count() == 0)